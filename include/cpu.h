@@ -7,111 +7,140 @@
 /* #include "nes.h" */
 
 
+// Actions are numbered densely from 0, so a program of actions fits in a uint8_t array
+// and the switch in execute_next_action can be compiled to a jump table.
 enum ACTION {
-    STALL_CYCLE = 0,
-    FETCH_OPCODE_INC_PC = 1,
-    FETCH_LOW_ADDR_BYTE_INC_PC = 2,
-    FETCH_HIGH_ADDR_BYTE_INC_PC = 3,
-    COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH = 301,
-    FETCH_VALUE_SAVE_TO_DEST = 4,
-    WRITE_REG_TO_EFF_ADDR_ZEROPAGE = 5,
-    PUSH_PCH_DEC_S = 6,
-    PUSH_PCL_DEC_S = 7,
-    FETCH_OPERAND_INC_PC = 8,
-    ADD_OPERAND_TO_PCL = 9,
-    INC_PC = 10,
-    INC_SP = 11,
-    INC_SOURCE_REG = 12,
-    DEC_SOURCE_REG = 13,
-    INC_MEMORY = 14,
-    DEC_MEMORY = 15,
-    BIT_READ_AFFECT_FLAGS = 308,
-    PULL_PCL_FROM_STACK_INC_SP = 309,
-    PULL_PCH_FROM_STACK = 16,
-    PULL_ACC_FROM_STACK_AFFECT_FLAGS = 17,
-    PUSH_ACC_DEC_SP = 18,
-    PULL_STATUS_REG_FROM_STACK_PLP = 19,
-    PUSH_STATUS_REG_DEC_SP = 20,
-    PULL_STATUS_REG_FROM_STACK_RTI = 29,
-    CLEAR_CARRY_FLAG = 90,
-    CLEAR_ZERO_FLAG = 91,
-    CLEAR_INTERRUPT_FLAG = 92,
-    CLEAR_DECIMAL_FLAG = 93,
-    CLEAR_BREAK_FLAG = 94,
-    CLEAR_OVERFLOW_FLAG = 95,
-    CLEAR_NEGATIVE_FLAG = 96,
-    SET_CARRY_FLAG = 100,
-    SET_ZERO_FLAG = 101,
-    SET_INTERRUPT_FLAG = 102,
-    SET_DECIMAL_FLAG = 103,
-    SET_BREAK_FLAG = 104,
-    SET_OVERFLOW_FLAG = 105,
-    SET_NEGATIVE_FLAG = 106,
-    COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS = 202,
-    COPY_SOURCE_REG_TO_DEST_REG_NO_FLAGS = 203,
-    WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE = 302,
-    READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS = 303,
-    READ_ADDR_ADD_INDEX_STORE_IN_OPERAND = 304,
-    FETCH_EFF_ADDR_LOW = 305,
-    FETCH_EFF_ADDR_HIGH = 306,
-    FETCH_EFF_ADDR_HIGH_ADD_INDEX = 3061,    
-    FETCH_ZP_PTR_ADDR_INC_PC = 307,
-    FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC = 310,
-    READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 311,
-    FETCH_HIGH_BYTE_ADDR_ADD_INDEX = 313,
-    ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 314,
-    AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 315,
-    EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 316,
-    ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 317,
-    CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 318,
-    SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 319,
-    STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 320,
-    STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE = 321,
-    FETCH_LOW_ADDR_TO_LATCH = 322,
-    FETCH_PCH_COPY_LATCH_TO_PCL = 323,
-    AND_IMM_INC_PC = 21,
-    CMP_IMM_INC_PC = 22,
-    ORA_IMM_INC_PC = 23,
-    EOR_IMM_INC_PC = 24,
-    ADC_IMM_INC_PC = 25,
-    CPY_IMM_INC_PC = 26,
-    CPX_IMM_INC_PC = 27,
-    SBC_IMM_INC_PC = 28,
-    LSR_SOURCE_REG = 404,
-    ASL_SOURCE_REG = 405,
-    ROR_SOURCE_REG = 406,
-    ROL_SOURCE_REG = 407,
-    LSR_MEMORY = 408,
-    ASL_MEMORY = 409,
-    ROR_MEMORY = 410,
-    ROL_MEMORY = 411,
-    ORA_MEMORY = 30,
-    AND_MEMORY = 31,
-    EOR_MEMORY = 32,
-    ADC_MEMORY = 33,
-    SBC_MEMORY = 35,
-    CMP_MEMORY = 36,
-    ZEROPAGE_ADD_INDEX = 500,
-    FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES = 700,
-    NOP_ABSOLUTE_X_MAYBE_STALL = 800,
-    LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS = 900,
-    SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS = 901,
-    DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY = 902,
-    FIX_HIGH_BYTE_NO_WRITE = 903,
-    FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE = 904,
-    ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY = 905,    
-    NMI_FETCH_PCL = 1000,
-    NMI_FETCH_PCH = 1001,
-    IRQ_FETCH_PCL = 1002,
-    IRQ_FETCH_PCH = 1003,
-    BRK_FETCH_PCL = 1004,
-    BRK_FETCH_PCH = 1005,
-    PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG = 1006,
-    PUSH_STATUS_REG_DEC_S_SET_B_FLAG = 1007,
-    SLO_DO_ASL_THEN_ORA = 1008,
-    RLA_DO_ROL_THEN_AND = 1009,
-    SRE_DO_LSR_THEN_EOR_ACC = 1010,
-    RRA_DO_ROR_THEN_ADC    = 1011,
+    STALL_CYCLE,
+    FETCH_OPCODE_INC_PC,
+    FETCH_LOW_ADDR_BYTE_INC_PC,
+    FETCH_HIGH_ADDR_BYTE_INC_PC,
+    COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH,
+    FETCH_VALUE_SAVE_TO_ACC,
+    FETCH_VALUE_SAVE_TO_X,
+    FETCH_VALUE_SAVE_TO_Y,
+    WRITE_ACC_TO_EFF_ADDR_ZEROPAGE,
+    WRITE_X_TO_EFF_ADDR_ZEROPAGE,
+    WRITE_Y_TO_EFF_ADDR_ZEROPAGE,
+    PUSH_PCH_DEC_S,
+    PUSH_PCL_DEC_S,
+    FETCH_OPERAND_INC_PC,
+    ADD_OPERAND_TO_PCL,
+    INC_PC,
+    INC_SP,
+    INC_X,
+    INC_Y,
+    DEC_X,
+    DEC_Y,
+    READ_EFF_ADDR_DUMMY_WRITE,
+    INC_MEMORY,
+    DEC_MEMORY,
+    BIT_READ_AFFECT_FLAGS,
+    PULL_PCL_FROM_STACK_INC_SP,
+    PULL_PCH_FROM_STACK,
+    PULL_ACC_FROM_STACK_AFFECT_FLAGS,
+    PUSH_ACC_DEC_SP,
+    PULL_STATUS_REG_FROM_STACK_PLP,
+    PUSH_STATUS_REG_DEC_SP,
+    PULL_STATUS_REG_FROM_STACK_RTI,
+    CLEAR_CARRY_FLAG,
+    CLEAR_ZERO_FLAG,
+    CLEAR_INTERRUPT_FLAG,
+    CLEAR_DECIMAL_FLAG,
+    CLEAR_BREAK_FLAG,
+    CLEAR_OVERFLOW_FLAG,
+    CLEAR_NEGATIVE_FLAG,
+    SET_CARRY_FLAG,
+    SET_ZERO_FLAG,
+    SET_INTERRUPT_FLAG,
+    SET_DECIMAL_FLAG,
+    SET_BREAK_FLAG,
+    SET_OVERFLOW_FLAG,
+    SET_NEGATIVE_FLAG,
+    COPY_ACC_TO_X_AFFECT_NZ_FLAGS,
+    COPY_ACC_TO_Y_AFFECT_NZ_FLAGS,
+    COPY_SP_TO_X_AFFECT_NZ_FLAGS,
+    COPY_X_TO_ACC_AFFECT_NZ_FLAGS,
+    COPY_Y_TO_ACC_AFFECT_NZ_FLAGS,
+    COPY_X_TO_SP_NO_FLAGS,
+    WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE,
+    WRITE_X_TO_EFF_ADDR_NON_ZEROPAGE,
+    WRITE_Y_TO_EFF_ADDR_NON_ZEROPAGE,
+    READ_EFF_ADDR_STORE_IN_ACC_AFFECT_NZ_FLAGS,
+    READ_EFF_ADDR_STORE_IN_X_AFFECT_NZ_FLAGS,
+    READ_EFF_ADDR_STORE_IN_Y_AFFECT_NZ_FLAGS,
+    READ_ZEROPAGE_STORE_IN_ACC_AFFECT_NZ_FLAGS,
+    READ_ZEROPAGE_STORE_IN_X_AFFECT_NZ_FLAGS,
+    READ_ZEROPAGE_STORE_IN_Y_AFFECT_NZ_FLAGS,
+    READ_ADDR_ADD_X_STORE_IN_OPERAND,
+    FETCH_EFF_ADDR_LOW,
+    FETCH_EFF_ADDR_HIGH,
+    FETCH_EFF_ADDR_HIGH_ADD_Y,
+    FETCH_ZP_PTR_ADDR_INC_PC,
+    FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+    FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+    READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_ACC,
+    READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_Y,
+    FETCH_HIGH_BYTE_ADDR_ADD_Y,
+    ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+    FETCH_LOW_ADDR_TO_LATCH,
+    FETCH_PCH_COPY_LATCH_TO_PCL,
+    AND_IMM_INC_PC,
+    CMP_IMM_INC_PC,
+    ORA_IMM_INC_PC,
+    EOR_IMM_INC_PC,
+    ADC_IMM_INC_PC,
+    CPY_IMM_INC_PC,
+    CPX_IMM_INC_PC,
+    SBC_IMM_INC_PC,
+    LSR_ACC,
+    LSR_ZEROPAGE,
+    ASL_ACC,
+    ASL_ZEROPAGE,
+    ROR_ACC,
+    ROR_ZEROPAGE,
+    ROL_ACC,
+    ROL_ZEROPAGE,
+    LSR_MEMORY,
+    ASL_MEMORY,
+    ROR_MEMORY,
+    ROL_MEMORY,
+    ORA_MEMORY,
+    AND_MEMORY,
+    EOR_MEMORY,
+    ADC_MEMORY,
+    SBC_MEMORY,
+    CMP_MEMORY,
+    CPX_MEMORY,
+    CPY_MEMORY,
+    ZEROPAGE_ADD_X,
+    ZEROPAGE_ADD_Y,
+    FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+    FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+    NOP_ABSOLUTE_X_MAYBE_STALL,
+    LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS,
+    SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS,
+    DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY,
+    FIX_HIGH_BYTE_NO_WRITE,
+    FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+    ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY,
+    INTERRUPT_FETCH_PCL,
+    INTERRUPT_FETCH_PCH,
+    BRK_FETCH_PCL,
+    BRK_FETCH_PCH,
+    PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG,
+    PUSH_STATUS_REG_DEC_S_SET_B_FLAG,
+    SLO_DO_ASL_THEN_ORA,
+    RLA_DO_ROL_THEN_AND,
+    SRE_DO_LSR_THEN_EOR_ACC,
+    RRA_DO_ROR_THEN_ADC,
+    NUMBER_OF_ACTIONS
 };
 
 
@@ -122,14 +151,18 @@ void print_regs(nes_state *state);
 void print_cpu_status(nes_state *state);
 void print_stack(nes_state *state);
 void cpu_step(nes_state *state);
+void start_instruction(nes_state *state);
+void execute_program_actions(nes_state *state, uint8_t count);
 nes_state* init_state();
 void set_pc(nes_state *state, unsigned short pc);
 uint8_t read_mem_byte(nes_state *state, unsigned short memloc);
 uint16_t read_mem_short(nes_state *state, unsigned short memloc);
 uint16_t translate_memory_location(unsigned short memloc);
-void add_action_to_queue(nes_state *state, uint16_t action);
+void add_stall_cycle(nes_state *state);
+void align_oam_dma(nes_state *state);
+bool is_instruction_done(nes_state *state);
 
-void trigger_interrupt(nes_state *state);
+void trigger_interrupt(nes_state *state, uint16_t vector);
 
 void set_negative_flag(nes_state *state);
 void set_overflow_flag(nes_state *state);
@@ -156,6 +189,11 @@ bool is_break_flag_set(nes_state *state);
 bool is_overflow_flag_set(nes_state *state);
 bool is_negative_flag_set(nes_state *state);
 
+void set_nz_from_result(nes_state *state, uint8_t result);
+void set_carry_from_result(nes_state *state, uint16_t result);
+void set_overflow_from_result(nes_state *state, uint8_t result);
+void build_status_reg(nes_state *state);
+
 
 
 #endif
@@ -0,0 +1,35 @@
+#ifndef CPU_FAST_H
+#define CPU_FAST_H
+
+#include <stdint.h>
+#include "definitions.h"
+
+// Execute one whole instruction (and a pending NMI) without stopping between cycles.
+// Adds the cycles to cpu_cycle and returns them, the caller is responsible for the ppu.
+uint16_t cpu_fast_step(nes_state *state);
+
+// Operations of the fast core, shared with the code generated by recompiler.c
+// They update the registers and flags, but do not touch PC or count cycles.
+void fast_push_byte(nes_state *state, uint8_t value);
+uint8_t fast_pull_byte(nes_state *state);
+void fast_adc(nes_state *state, uint8_t value);
+void fast_sbc(nes_state *state, uint8_t value);
+void fast_compare(nes_state *state, uint8_t reg, uint8_t value);
+void fast_bit(nes_state *state, uint8_t value);
+uint8_t fast_asl(nes_state *state, uint8_t value);
+uint8_t fast_lsr(nes_state *state, uint8_t value);
+uint8_t fast_rol(nes_state *state, uint8_t value);
+uint8_t fast_ror(nes_state *state, uint8_t value);
+void fast_load_acc(nes_state *state, uint8_t value);
+void fast_load_x(nes_state *state, uint8_t value);
+void fast_load_y(nes_state *state, uint8_t value);
+void fast_ora(nes_state *state, uint8_t value);
+void fast_and(nes_state *state, uint8_t value);
+void fast_eor(nes_state *state, uint8_t value);
+void fast_lax(nes_state *state, uint8_t value);
+
+// Read-modify-write instructions, including the illegal combined ones
+enum RMW_OP { RMW_ASL, RMW_LSR, RMW_ROL, RMW_ROR, RMW_INC, RMW_DEC, RMW_SLO, RMW_RLA, RMW_SRE, RMW_RRA, RMW_DCP, RMW_ISB };
+void fast_read_modify_write(nes_state *state, uint16_t addr, uint8_t op);
+
+#endif
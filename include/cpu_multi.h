@@ -0,0 +1,44 @@
+#ifndef CPU_MULTI_H
+#define CPU_MULTI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// Instances run side by side. 16 fill a 128 bit vector, build with
+// -DMULTI_LANES=32 -mavx2 for 256 bit vectors.
+#ifndef MULTI_LANES
+#define MULTI_LANES 16
+#endif
+
+// One byte per instance, see the GCC vector extensions
+typedef uint8_t lane_bytes __attribute__ ((vector_size (MULTI_LANES)));
+
+// The cpus of MULTI_LANES copies of the same rom, as a struct of arrays.
+// Lane i of every register and every RAM byte belongs to instance i.
+// Like bench -p, only the cpu runs, the ppus are not stepped.
+typedef struct MULTI_STATE {
+    lane_bytes acc, x, y, sp, sr;
+    uint16_t pc[MULTI_LANES];
+    uint64_t cpu_cycle[MULTI_LANES];
+    lane_bytes ram[0x800]; // ram[addr][lane]
+    // The state of every instance, for its rom, and for running the instructions
+    // the vector step doesn't handle on the fast core
+    nes_state *lanes[MULTI_LANES];
+    bool stopped[MULTI_LANES]; // Fatal error
+    bool banked; // The mapper switches banks, lanes at the same PC can run different code
+    uint64_t end_cycle; // Lanes at or past it are not stepped
+    uint64_t vector_instructions; // Instructions run for all lanes at a PC at once
+    uint64_t scalar_instructions; // Instructions run one lane at a time on the fast core
+} multi_state;
+
+// Takes the registers and RAM of the states, which must run the same rom (and stay owned by the caller)
+multi_state *init_multi_state(nes_state *lanes[MULTI_LANES]);
+// Run one instruction for all the lanes at the PC of the lane furthest behind.
+// Returns the number of lanes stepped, 0 when every lane is done or stopped.
+uint32_t multi_step(multi_state *m);
+// Copy the registers, RAM and cycle count of a lane back to its state
+void store_lane(multi_state *m, uint8_t lane);
+void free_multi_state(multi_state *m);
+
+#endif
@@ -0,0 +1,55 @@
+#ifndef DECODE_CACHE_H
+#define DECODE_CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+#include "microcode.h"
+
+enum ADDRESSING_MODE {
+    MODE_IMPLIED, // Also accumulator
+    MODE_IMMEDIATE,
+    MODE_ZEROPAGE,
+    MODE_ZEROPAGE_X,
+    MODE_ZEROPAGE_Y,
+    MODE_ABSOLUTE,
+    MODE_ABSOLUTE_X,
+    MODE_ABSOLUTE_Y,
+    MODE_RELATIVE,
+    MODE_INDEXED_INDIRECT, // (zp,X)
+    MODE_INDIRECT_INDEXED, // (zp),Y
+    MODE_INDIRECT // JMP ($nnnn)
+};
+
+// An instruction decoded once, so the cores don't have to go through read_mem
+// for the opcode and operands every time it runs.
+typedef struct DECODED_INSTRUCTION {
+    const microcode_program *program; // The handler of the cycle core, NULL if not implemented
+    uint16_t operand; // Operand bytes, little endian
+    uint8_t opcode;
+    uint8_t mode; // enum ADDRESSING_MODE
+    uint8_t size; // Bytes, including the opcode
+    uint8_t cycles; // Base cycles, branches not taken
+    bool valid;
+} decoded_instruction;
+
+// Decoded instructions by their offset in PRG-ROM, so they stay valid when the mapper
+// switches banks. Filled as code runs.
+typedef struct DECODE_CACHE {
+    decoded_instruction *entries; // One per byte of PRG-ROM
+    decoded_instruction *pages[0x80]; // Entries of the bank at each page of $8000-$FFFF, NULL until looked up
+    decoded_instruction uncached; // Last instruction decoded outside of PRG-ROM
+} decode_cache;
+
+// Decode the instruction at pc. PRG-ROM instructions are cached,
+// code in RAM is decoded again on every call.
+const decoded_instruction *decode_instruction(nes_state *state, uint16_t pc);
+// enum ADDRESSING_MODE of an opcode
+uint8_t opcode_mode(uint8_t opcode);
+// Must be called when another rom is attached
+void flush_decode_cache(nes_state *state);
+// Called by map_prg_rom, the pages of $8000-$FFFF in addr to addr + size now have another bank
+void remap_decode_cache(nes_state *state, uint16_t addr, uint32_t size);
+void free_decode_cache(nes_state *state);
+
+#endif
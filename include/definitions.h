@@ -1,6 +1,7 @@
 #ifndef DEFINITIONS_H
 #define DEFINITIONS_H
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 // Define a structure for the CPU registers
@@ -19,15 +20,25 @@ typedef struct CPU_STATE {
   uint8_t current_opcode;
   uint8_t low_addr_byte;
   uint8_t high_addr_byte;
-  uint8_t *destination_reg;
-  uint8_t *source_reg;
-  uint8_t *index_reg;
   uint8_t operand;
   uint16_t current_opcode_PC;
   uint64_t cpu_cycle;
-  uint16_t action_queue[16];
-  uint8_t next_action;
-  uint8_t end_of_queue;
+  const uint8_t *program; // Actions of the current instruction, see microcode.c
+  uint8_t program_length;
+  uint8_t next_action; // Index into program
+  bool in_interrupt; // Running interrupt_program, the instruction at the handler follows it
+  uint8_t interrupt_lines; // Raised IRQ lines and a latched NMI edge, see interrupt.h
+  bool nmi_line; // Level of the NMI line, for finding its rising edge
+  uint16_t interrupt_vector; // Of the interrupt being taken
+  uint16_t polled_interrupt; // Vector polled in the last cycle, taken if the instruction ended there
+  const uint8_t *fetch_page; // Host memory of the 256 byte page PC is in, see fetch_pc
+  uint16_t fetch_page_base; // Address of that page, FETCH_PAGE_INVALID when there is none
+  uint16_t stall_cycles; // Extra cycles to run after the program (page crossings, branches, OAM DMA)
+  bool oam_dma_align; // An OAM DMA was started, it may need a cycle more, see align_oam_dma
+  uint8_t lazy_flags; // Bits of SR not yet computed from the results below (-DLAZY_FLAGS)
+  uint8_t nz_result;
+  uint8_t overflow_result;
+  uint16_t carry_result;
 
 } cpu_state;
 
@@ -46,9 +57,13 @@ typedef struct PPU_REGISTERS {
 
 // https://wiki.nesdev.com/w/index.php/PPU_memory_map
 typedef struct PPU_STATE {
-  uint8_t *ppu_vram; // 2kb vram in ppu
+  uint8_t *ppu_vram; // 2kb vram in ppu, and 2kb more for four screen boards
   uint8_t *palette_table; // 32 byte palette table
   uint8_t *chr_rom; // CHR_ROM in the rom (8kb only for now)
+  // $0000-$2FFF in pages of 1kb: the CHR banks of the pattern tables and the four nametables.
+  // Mappers switch CHR banks and mirroring by changing these, see map_chr and set_mirroring.
+  uint8_t *pattern_tables[8];
+  uint8_t *nametables[4];
   uint8_t *oam_memory; // 256 bytes of Object Attribute Memory
   ppu_registers *registers;
   uint16_t ppu_cycle;
@@ -58,11 +73,16 @@ typedef struct PPU_STATE {
   uint8_t address_latch; // "dynamic latch" aka. internal buffer in ppu used by $2005, $2006 and $2007
   uint16_t internal_addr_reg; // Use for the internal addr written through the ppu_addr $2006 register, updated by reads from $2007
     bool nmi_occurred;
+  uint32_t pending_dots; // Dots the ppu is behind the cpu, see ppu_catch_up
+  // PPU A12 for the scanline counter of the mapper, see schedule_a12
+  uint16_t a12_cycle; // Dot of the rendered scanlines A12 rises at, or the next dot when followed exactly
+  bool a12_exact; // $2000 or $2001 changed mid-frame, A12 is followed dot by dot until vblank
+  uint8_t a12_low; // Dots A12 has been low, when followed
 } ppu_state;
 
 
 // A struct representing a ROM in the iNES format
-// Currently only mapper 0
+// The banks are mapped into the cpu and ppu by the mapper, see mapper.c
 typedef struct NES_ROM {
   uint8_t prg_rom_size; // size of PRG ROM in 16 kb units
   uint8_t chr_rom_size; // size of CHR ROM in 8 kb units (Value 0 means the board uses CHR RAM)
@@ -77,12 +97,37 @@ typedef struct NES_ROM {
   /*   byte is zero. */
   uint8_t prg_ram_size; // (rarely used extension)
   bool ntsc; // true for ntsc, false for PAL
-  uint8_t *prg_rom1; // Pointer to first part of PRG_ROM (for memory mapping) $8000-$BFFF
-  uint8_t *prg_rom2; // Pointer to second part of PRG_ROM (for memory mapping) $C000-$FFFF
-  uint8_t *chr_rom; // pointer to CHR ROM (for memory mapping)
+  uint8_t *prg_rom; // All of PRG_ROM, prg_rom_size * 16kb
+  uint8_t *chr_rom; // All of CHR ROM, or 8kb of CHR RAM if chr_rom_size is 0
+  uint8_t *image; // The read-only mapping of the file the banks point into, NULL for a rom built in memory
+  size_t image_size;
 } nes_rom;
 
 
+// What read_mem/write_mem do in a page without host memory, see memory.c
+enum BUS_HANDLER {
+  BUS_OPEN, // Nothing mapped: reads are a fatal error, writes are ignored
+  BUS_PPU, // $2000-$3FFF, the PPU registers and their mirrors
+  BUS_IO, // $4000-$40FF, the APU and IO registers at $4000-$401F
+  BUS_ROM // PRG-ROM, only writes get here, they go to the mapper registers
+};
+
+// The cpu address space as 256 pages of 256 bytes. A page of plain memory has a host pointer,
+// everything else goes through the handler of its page. Mapping a bank only changes pointers.
+typedef struct MEMORY_MAP {
+  uint8_t *read[0x100]; // Host memory of the page, NULL: read through the handler
+  uint8_t *write[0x100]; // NULL for ROM and io pages
+  uint8_t handler[0x100]; // enum BUS_HANDLER
+} memory_map;
+
+// Which cpu core runs the instructions
+enum CPU_CORE {
+  CYCLE_CORE, // cpu_step, one action per cycle
+  FAST_CORE, // cpu_fast_step, one instruction at a time
+  SYNC_CORE, // cpu_step for a whole instruction, the ppu catches up at io accesses
+  RECOMPILED_CORE // code generated ahead of time by recompiler.c, only in emu_aot
+};
+
 // A struct representing the state of the console
 // With pointers to cpu (registers), memory(stack+ram), ppu and apu
 // Also contains information about the master clock
@@ -90,6 +135,7 @@ typedef struct NES_STATE {
   uint64_t master_clock;
   cpu_state *cpu;
   uint8_t *memory; // Pointer to start of memory
+  memory_map map; // Pages of the cpu bus, in the state so an access is a single load from it
   /* uint8_t *rom; // Pointer to memory containing the ROM */
   nes_rom *rom; // pointer to the rom struct
   bool running; // is the emulator still running?
@@ -97,6 +143,12 @@ typedef struct NES_STATE {
   /* uint16_t ppu_cycle; */
   /* uint16_t ppu_scanline; */
   bool fatal_error;
+  uint8_t core; // enum CPU_CORE
+  struct DECODE_CACHE *decode_cache; // Decoded PRG-ROM instructions, see decode_cache.c
+  struct IDLE_LOOP *idle_loop; // NULL unless idle loops are skipped, see idle_loop.c
+  struct PROFILER *profiler; // NULL unless the guest code is profiled, see profiler.c
+  struct MAPPER *mapper; // Bank registers of the cartridge, see mapper.c
+  struct PRG_RAM *prg_ram; // Work RAM of the cartridge at $6000-$7FFF, see prg_ram.c
 } nes_state;
 
 #endif
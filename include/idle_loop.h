@@ -0,0 +1,35 @@
+#ifndef IDLE_LOOP_H
+#define IDLE_LOOP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// Longest loop, in instructions, that is checked for being idle
+#define MAX_IDLE_LOOP_LENGTH 4
+
+// A short loop that reads one location until it changes, like LDA $2002 / BPL
+// or polling a RAM flag set by the NMI handler.
+typedef struct IDLE_LOOP {
+    uint16_t head; // First instruction, the target of the branch at the end
+    bool candidate; // The code at head looks like an idle loop
+    uint16_t watched; // Address read by the loop, RAM or $2002
+    uint8_t cycles; // Cycles of one iteration
+    // State at the last time PC arrived at head
+    uint64_t arrived_cycle;
+    uint8_t acc;
+    uint8_t x;
+    uint8_t y;
+    uint8_t sp;
+    uint8_t sr;
+    uint8_t value; // The value the next read of watched returns
+} idle_loop;
+
+// Skip iterations of an idle loop at PC, up to the next ppu event that could change
+// what the loop reads, and at most budget cycles. Must be called between instructions.
+// Returns the cpu cycles skipped, 0 if PC is not in an idle loop.
+uint32_t skip_idle_loop(nes_state *state, uint32_t budget);
+void enable_idle_loop_skipping(nes_state *state);
+void free_idle_loop(nes_state *state);
+
+#endif
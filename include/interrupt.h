@@ -0,0 +1,42 @@
+#ifndef INTERRUPT_H
+#define INTERRUPT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// The interrupt lines of the cpu, as bits of cpu->interrupt_lines.
+// IRQ sources raise their line and keep it raised until the program acknowledges
+// them at the source (like reading $4015 for the frame counter),
+// the cpu takes an IRQ at every boundary where a line is up and the I flag is clear.
+// The NMI line is edge triggered, a rising edge sets NMI_EDGE until the NMI is taken.
+enum INTERRUPT_LINE {
+    IRQ_APU_FRAME = 1, // APU frame counter
+    IRQ_DMC = 2, // APU DMC channel, end of sample
+    IRQ_MAPPER = 4, // Cartridge, like the MMC3 scanline counter
+    IRQ_LINES = 0x7F,
+    NMI_EDGE = 0x80
+};
+
+#define NMI_VECTOR 0xFFFA
+#define IRQ_VECTOR 0xFFFE
+
+void raise_irq(nes_state *state, uint8_t line);
+void lower_irq(nes_state *state, uint8_t line);
+// Drive the NMI line, latches NMI_EDGE when it goes from low to high
+void set_nmi_line(nes_state *state, bool level);
+
+// The vector of the interrupt the cpu would take at this boundary, 0 if none.
+// Only called when cpu->interrupt_lines is non zero, that test is the fast path.
+uint16_t poll_interrupts(nes_state *state);
+// The cpu starts the interrupt sequence for vector, an NMI uses up its edge
+void acknowledge_interrupt(nes_state *state, uint16_t vector);
+
+// Poll in the last cycle of an instruction, the result decides what runs after it.
+// The cycle core polls every cycle, the other cores after the ppu has run the dots of
+// the whole instruction, which is the same point. Usually no line is up, and this is one test.
+static inline void poll_interrupt_lines(nes_state *state) {
+    state->cpu->polled_interrupt = state->cpu->interrupt_lines ? poll_interrupts(state) : 0;
+}
+
+#endif
@@ -0,0 +1,48 @@
+#ifndef MAPPER_H
+#define MAPPER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// iNES mapper numbers of the boards in mapper.c
+enum MAPPER_NUMBER {
+    MAPPER_NROM = 0,
+    MAPPER_MMC1 = 1,
+    MAPPER_UXROM = 2,
+    MAPPER_CNROM = 3,
+    MAPPER_MMC3 = 4,
+    MAPPER_AXROM = 7
+};
+
+// The board of the cartridge. Its banks are mapped by pointing the pages of state->map
+// (PRG-ROM) and ppu->pattern_tables (CHR) into the rom, so a bank switch rewrites a few
+// pointers and the cores never call the mapper on a read.
+typedef struct MAPPER {
+    const char *name;
+    // Map the banks the board starts with
+    void (*reset)(nes_state *state);
+    // A cpu write to $8000-$FFFF. NULL if the board has no registers, the write is a fatal error.
+    void (*write)(nes_state *state, uint16_t addr, uint8_t value);
+    // PPU A12 rose after being low for a while, once per rendered scanline in most games
+    // (see schedule_a12). NULL if the board doesn't count scanlines. Boards raise IRQ_MAPPER from here.
+    void (*scanline)(nes_state *state);
+    // Board registers
+    uint8_t registers[8]; // MMC1 control, CHR 0, CHR 1, PRG. MMC3 R0-R7.
+    uint8_t bank_select; // MMC3 $8000
+    uint8_t shift; // MMC1 serial port
+    uint8_t shift_count;
+    uint64_t last_write_cycle; // MMC1 ignores the second write of a read-modify-write
+    uint8_t irq_latch; // MMC3 scanline counter
+    uint8_t irq_counter;
+    bool irq_reload;
+    bool irq_enabled;
+} mapper;
+
+// Set up state->mapper for state->rom and map its banks. An unknown mapper is a fatal error.
+void init_mapper(nes_state *state);
+void free_mapper(nes_state *state);
+// Called by the ppu when A12 rises
+void mapper_scanline(nes_state *state);
+
+#endif
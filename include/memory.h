@@ -7,10 +7,102 @@
 #include "cpu.h"
 #include "ppu.h"
 
-// Functions for memory read/write in the nes
-uint8_t read_mem(nes_state *state, uint16_t memloc);
-void write_mem(nes_state *state, uint16_t memloc, uint8_t value);
+// Build state->map for RAM and io, the mapper maps PRG-ROM into it
+void map_memory(nes_state *state);
+// Map size bytes of PRG-ROM at addr (both multiples of 256), for mappers switching banks
+void map_prg_rom(nes_state *state, uint16_t addr, uint8_t *bank, uint32_t size);
+
+// Which of the two nametables of ppu_vram appear at $2000, $2400, $2800 and $2C00
+enum MIRRORING {
+  MIRROR_HORIZONTAL,
+  MIRROR_VERTICAL,
+  MIRROR_SINGLE_LOW,
+  MIRROR_SINGLE_HIGH,
+  MIRROR_FOUR_SCREEN // All four, the board has 2kb more VRAM
+};
+// Map size bytes of CHR at the ppu address addr (both multiples of 1kb)
+void map_chr(nes_state *state, uint16_t addr, uint8_t *bank, uint32_t size);
+void set_mirroring(nes_state *state, uint8_t mirroring);
+// Accesses to pages without host memory, by the handler of the page
+uint8_t read_io(nes_state *state, uint16_t memloc);
+void write_io(nes_state *state, uint16_t memloc, uint8_t value);
+// read_io without the side effects, see peek_mem
+uint8_t peek_io(nes_state *state, uint16_t memloc);
+
+// Functions for memory read/write in the nes. Plain memory is a page lookup and a load,
+// anything else goes through read_io/write_io.
+static inline uint8_t read_mem(nes_state *state, uint16_t memloc) {
+  const uint8_t *page = state->map.read[memloc >> 8];
+  if (page != NULL) {
+    return page[memloc & 0xFF];
+  }
+  return read_io(state, memloc);
+}
+
+static inline void write_mem(nes_state *state, uint16_t memloc, uint8_t value) {
+  uint8_t *page = state->map.write[memloc >> 8];
+  if (page != NULL) {
+    page[memloc & 0xFF] = value;
+    return;
+  }
+  write_io(state, memloc, value);
+}
+
+// The byte a cpu read of memloc would return, without any side effects on the emulation.
+// For everything that looks at memory without being the cpu: the logger, the debugger and tools.
+static inline uint8_t peek_mem(nes_state *state, uint16_t memloc) {
+  const uint8_t *page = state->map.read[memloc >> 8];
+  if (page != NULL) {
+    return page[memloc & 0xFF];
+  }
+  return peek_io(state, memloc);
+}
+
 uint8_t read_mem_ppu(nes_state *state, uint16_t memloc);
 void write_mem_ppu(nes_state *state, uint16_t memloc, uint8_t value);
 
+// Zero page and stack, $0000-$01FF, are always internal RAM. These index state->memory
+// directly, without the range checks of read_mem/write_mem.
+static inline uint8_t read_zp(nes_state *state, uint8_t addr) {
+  return state->memory[addr];
+}
+
+static inline void write_zp(nes_state *state, uint8_t addr, uint8_t value) {
+  state->memory[addr] = value;
+}
+
+// The byte at $0100+SP. Pushing writes here and then decrements SP, pulling increments SP first.
+static inline uint8_t read_stack(nes_state *state) {
+  return state->memory[0x100 | state->cpu->registers->SP];
+}
+
+static inline void write_stack(nes_state *state, uint8_t value) {
+  state->memory[0x100 | state->cpu->registers->SP] = value;
+}
+
+// Never a page address, forces fetch_pc to look up the page again
+#define FETCH_PAGE_INVALID 0x0001
+
+// Host memory of the 256 bytes at page (RAM or PRG-ROM), NULL if reads there have side effects
+static inline const uint8_t *memory_page(nes_state *state, uint16_t page) {
+  return state->map.read[page >> 8];
+}
+// Must be called whenever the PRG-ROM mapped at $8000-$FFFF changes, map_prg_rom does
+void invalidate_fetch_page(nes_state *state);
+
+// Read the byte at PC, for opcode and operand fetches. Sequential fetches in the same page
+// are a compare and a load, jumps and page changes show up as a different page base.
+static inline uint8_t fetch_pc(nes_state *state) {
+  uint16_t pc = state->cpu->registers->PC;
+  if ((pc & 0xFF00) != state->cpu->fetch_page_base) {
+    const uint8_t *page = memory_page(state, pc & 0xFF00);
+    if (page == NULL) {
+      return read_mem(state, pc);
+    }
+    state->cpu->fetch_page = page;
+    state->cpu->fetch_page_base = pc & 0xFF00;
+  }
+  return state->cpu->fetch_page[pc & 0xFF];
+}
+
 #endif
@@ -0,0 +1,34 @@
+#ifndef MICROCODE_H
+#define MICROCODE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The longest instruction (the RMW illegals) takes 8 cycles
+#define MAX_PROGRAM_LENGTH 8
+
+// Bits in the status register, used as branch conditions
+#define CARRY_FLAG 1
+#define ZERO_FLAG 2
+#define OVERFLOW_FLAG 64
+#define NEGATIVE_FLAG 128
+
+// The cycles of one opcode, one action per cycle, see http://nesdev.com/6502_cpu.txt
+// Extra cycles for page crossings and taken branches are added by the actions themselves.
+typedef struct MICROCODE_PROGRAM {
+    uint8_t length; // Number of actions, including the opcode fetch. 0 means not implemented.
+    uint8_t actions[MAX_PROGRAM_LENGTH];
+    bool clear_low_addr_byte;
+    bool clear_high_addr_byte;
+    // Branches: the last action only runs if (SR & branch_mask) == branch_value.
+    // Both are 0 for everything else, so the condition always holds.
+    uint8_t branch_mask;
+    uint8_t branch_value;
+} microcode_program;
+
+extern const microcode_program microcode[256];
+// Used for opcodes that are not implemented yet. Fetches the opcode and nothing else.
+extern const microcode_program unknown_program;
+extern const microcode_program interrupt_program;
+
+#endif
@@ -12,6 +12,9 @@ void destroy_state(nes_state *state);
 void power_on(nes_state *state);
 void reset(nes_state *state);
 void step(nes_state *state);
+uint16_t step_instruction(nes_state *state);
+uint32_t step_synced(nes_state *state);
+uint32_t step_core(nes_state *state, uint32_t budget);
 void ppu_step(nes_state *state);
 void print_state(nes_state *state);
 /* void attach_rom(nes_state *state, unsigned char *rommem); */
@@ -3,9 +3,26 @@
 #include "definitions.h"
 
 void incr_addr_reg(nes_state *state);
+void update_nmi_line(nes_state *state);
+void write_ctrl_reg(nes_state *state, uint8_t value);
+void write_mask_reg(nes_state *state, uint8_t value);
 uint8_t read_status_reg(nes_state *state);
 uint8_t read_data_reg(nes_state *state);
+uint8_t peek_status_reg(nes_state *state);
+uint8_t peek_data_reg(nes_state *state);
 uint8_t read_oam_data_reg(nes_state *state);
+// Cycles the cpu is halted for an OAM DMA, one more if it starts on an odd cycle
+#define OAM_DMA_CYCLES 513
+void oam_dma(nes_state *state, uint8_t page);
+
+// Dot of the scanline PPU A12 rises at for the mapper, see schedule_a12
+#define A12_NONE 0xFFFF
+void schedule_a12(nes_state *state);
+void a12_settings_changed(nes_state *state);
 
 void ppu_step(nes_state *state);
+void ppu_run(nes_state *state, uint16_t dots);
+void ppu_catch_up(nes_state *state);
+uint32_t ppu_dots_to_next_event(nes_state *state);
+void ppu_skip(nes_state *state, uint32_t dots);
 #endif
@@ -0,0 +1,25 @@
+#ifndef PRG_RAM_H
+#define PRG_RAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// The work RAM of the cartridge at $6000-$7FFF, mapped into the page table like the 2kb of RAM.
+// With a battery it is an mmap of the .sav file next to the rom, so a save is a store to memory
+// and the kernel writes it to the file, even if the emulator crashes.
+typedef struct PRG_RAM {
+    uint8_t *memory; // prg_ram_size * 8kb, the first 8kb are mapped at $6000
+    uint32_t size;
+    bool file_backed; // memory is a shared mapping of the .sav file
+} prg_ram;
+
+// Map prg_ram_size * 8kb of zeroed RAM at $6000-$7FFF for state->rom
+void init_prg_ram(nes_state *state);
+// Back the RAM with the .sav next to rom_filename (created if missing). Prints why it can't
+// and returns false, the RAM then stays in memory only.
+bool attach_save_file(nes_state *state, const char *rom_filename);
+// Unmaps the file without waiting for it to be written
+void free_prg_ram(nes_state *state);
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "definitions.h"
+
+// Deepest call stack that is followed, deeper calls are counted in the deepest frame
+#define MAX_PROFILE_DEPTH 64
+// PRG-ROM banks of 16kb that get their own totals
+#define MAX_PROFILE_BANKS 256
+// Frame entries of the interrupt handlers in the call tree
+#define PROFILE_NMI_FRAME 0xFFFA
+#define PROFILE_IRQ_FRAME 0xFFFE
+
+// A routine in the call tree: entered through JSR (or an interrupt) from its parent
+typedef struct PROFILE_NODE {
+    uint16_t entry; // Address called, or PROFILE_NMI_FRAME / PROFILE_IRQ_FRAME
+    uint32_t parent;
+    uint32_t first_child;
+    uint32_t next_sibling;
+    uint64_t calls;
+    uint64_t cycles; // Spent in the routine itself, not in what it called
+} profile_node;
+
+// Instructions and cycles of the guest code, per PC, per bank and per call stack
+typedef struct PROFILER {
+    uint64_t instructions[0x10000];
+    uint64_t cycles[0x10000];
+    uint64_t bank_instructions[MAX_PROFILE_BANKS];
+    uint64_t bank_cycles[MAX_PROFILE_BANKS];
+    // Instruction mix, by opcode
+    uint64_t opcode_count[256];
+    uint64_t opcode_cycles[256];
+    uint64_t page_crossings[256]; // Took the extra cycle of an indexed access crossing a page
+    uint64_t branches_taken[256];
+    // The instruction at the last boundary, it gets the cycles up to the next one
+    uint16_t last_pc;
+    uint8_t last_opcode;
+    uint8_t last_mode;
+    uint8_t last_base_cycles;
+    uint64_t last_cycle;
+    bool started;
+    uint16_t pending_interrupt; // Vector of an interrupt taken since the last boundary, 0 if none
+    // Call tree, node 0 is the code running when profiling started
+    profile_node *nodes;
+    uint32_t node_count;
+    uint32_t node_capacity;
+    uint32_t current; // Node of the running routine
+    uint32_t depth;
+} profiler;
+
+void enable_profiler(nes_state *state);
+void free_profiler(nes_state *state);
+// Count the instruction at current_opcode_PC, called at every instruction boundary with the log
+void profile_instruction(nes_state *state);
+// The cpu takes an interrupt, its handler gets a frame at the next boundary
+void profile_interrupt(nes_state *state, uint16_t vector);
+// Hottest routines and PCs, and the totals per bank
+void write_profile_report(nes_state *state, FILE *out);
+// One line per call stack, "entry;entry;... cycles", for flamegraph.pl and similar tools
+void write_folded_stacks(nes_state *state, FILE *out);
+// Executed opcodes and addressing modes, with page crossings and taken branches, tab separated
+void write_instruction_mix(nes_state *state, FILE *out);
+
+// Called where the cores log an instruction. Costs a single test when profiling is off.
+static inline void profile_boundary(nes_state *state) {
+    if (state->profiler != NULL) {
+        profile_instruction(state);
+    }
+}
+
+#endif
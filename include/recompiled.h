@@ -0,0 +1,29 @@
+#ifndef RECOMPILED_H
+#define RECOMPILED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "definitions.h"
+
+// A function generated by the recompiler (recompiler.c) for the code starting at a PC.
+// Runs instructions until the next jump, branch or io access, or until the budget is used up,
+// and returns the cpu cycles it took.
+typedef uint32_t (*recompiled_block)(nes_state *state, uint32_t budget);
+
+// Defined by the generated unit. Functions by PC, for $8000-$FFFF, NULL where nothing was found.
+extern const recompiled_block recompiled_blocks[0x8000];
+// prg_rom_hash of the rom the unit was generated from
+extern const uint32_t recompiled_prg_hash;
+
+// Can the generated unit run this rom?
+bool is_recompiled_from(nes_rom *rom);
+// Run the generated function at PC, or a single instruction with the fast core if there is none
+uint32_t step_recompiled(nes_state *state, uint32_t budget);
+
+// Used by the generated code, around every instruction, like step_instruction does.
+// begin logs the instruction and returns true if an interrupt was polled, which recompiled_interrupt runs instead.
+bool begin_recompiled_instruction(nes_state *state, uint16_t pc, uint8_t opcode);
+uint16_t recompiled_interrupt(nes_state *state);
+uint8_t end_recompiled_instruction(nes_state *state, uint8_t cycles);
+
+#endif
@@ -2,13 +2,15 @@
 #define ROM_LOADER_H
 #include "definitions.h"
 
-// Load the rom "filename" into rombuf, create the nes_rom
-// returns 0 on success, 1 on error
-int load_rom2(char *filename, uint8_t **rombuf, nes_rom *rom);
+// Map the rom "filename" and fill in rom, the banks point into the mapping (see nes_rom.image).
+// Returns 0 on success, 1 on error, also when the file is shorter than the header says.
+int load_rom2(char *filename, nes_rom *rom);
 // Return a pointer to an empty nes_rom struct
 /* static nes_rom* init_rom_struct(); */
-// Free the allocations separate to ROM
+// Unmap the image and free the allocations separate to ROM
 void free_rom(nes_rom *rom);
 void print_rom_info(nes_rom *rom);
+// Hash of the 32kb mapper 0 maps at $8000-$FFFF
+uint32_t prg_rom_hash(nes_rom *rom);
 
 #endif
@@ -0,0 +1,448 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "cpu.h"
+#include "cpu_fast.h"
+#include "cpu_multi.h"
+#include "idle_loop.h"
+#include "memory.h"
+#include "nes.h"
+#include "rom_loader.h"
+
+// Benchmark of the cpu cores. Runs nestest.nes (or another rom) from $C000
+// a number of times with logging disabled, and reports emulated cpu cycles per second.
+// With -p only the cpu is stepped (cycle and fast core), to measure the cpu core on its own.
+// With -i idle loops are skipped.
+// With -m MULTI_LANES copies run together on cpu_multi.c, and one after the other on the fast core,
+// both cpu only, and the instructions per second of both are reported.
+// With -o every case in opcode_cases runs on its own from a generated rom (cycle or fast core, cpu only),
+// and the host nanoseconds per emulated cycle of each case are reported as tab separated columns.
+// With -u only the bus runs: the same mix of RAM and PRG-ROM accesses through read_mem/write_mem
+// and through the range tests they used before the page table, 100 rounds of 4096 per run.
+// The emulator prints to stdout, so the result is written to stderr.
+// Usage: bench [-f|-y|-m] [-o] [-p] [-u] [-i] [-n runs] [-c cycles] [rom]
+
+#ifdef THREADED_DISPATCH
+#define DISPATCH_NAME "threaded"
+#else
+#define DISPATCH_NAME "switch"
+#endif
+
+#ifdef LAZY_FLAGS
+#define FLAGS_NAME "lazy"
+#else
+#define FLAGS_NAME "eager"
+#endif
+
+static const char *core_names[] = { "cycle", "fast", "sync" };
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// A console running the rom from $C000, or NULL if it can't be loaded
+static nes_state *start_state(char *filename) {
+  nes_rom *rom = malloc(sizeof(nes_rom));
+  if (load_rom2(filename, rom) != 0) {
+    free(rom);
+    return NULL;
+  }
+  nes_state *state = init_state();
+  attach_rom(state, rom);
+  reset(state);
+  set_pc(state, 0xC000);
+  return state;
+}
+
+static bool same_cpu_state(nes_state *a, nes_state *b) {
+  registers *ra = a->cpu->registers;
+  registers *rb = b->cpu->registers;
+  build_status_reg(a);
+  build_status_reg(b);
+  return ra->PC == rb->PC && ra->ACC == rb->ACC && ra->X == rb->X && ra->Y == rb->Y
+    && ra->SP == rb->SP && ra->SR == rb->SR && a->cpu->cpu_cycle == b->cpu->cpu_cycle
+    && memcmp(a->memory, b->memory, 0x800) == 0;
+}
+
+static int bench_multi(char *filename, uint32_t runs, uint32_t cycles_per_run) {
+  uint64_t separate_instructions = 0, multi_instructions = 0, vector_instructions = 0;
+  double separate_time = 0, multi_time = 0;
+  bool same = true;
+  for (uint32_t run = 0; run < runs; run++) {
+    nes_state *separate[MULTI_LANES], *lanes[MULTI_LANES];
+    for (uint8_t l = 0; l < MULTI_LANES; l++) {
+      separate[l] = start_state(filename);
+      lanes[l] = start_state(filename);
+      if (separate[l] == NULL || lanes[l] == NULL) {
+        return EXIT_FAILURE;
+      }
+    }
+
+    double start = now();
+    for (uint8_t l = 0; l < MULTI_LANES; l++) {
+      uint64_t end_cycle = separate[l]->cpu->cpu_cycle + cycles_per_run;
+      while (separate[l]->cpu->cpu_cycle < end_cycle && !separate[l]->fatal_error) {
+        cpu_fast_step(separate[l]);
+        separate_instructions++;
+      }
+    }
+    separate_time += now() - start;
+
+    multi_state *m = init_multi_state(lanes);
+    m->end_cycle = m->cpu_cycle[0] + cycles_per_run;
+    start = now();
+    uint32_t stepped;
+    while ((stepped = multi_step(m)) > 0) {
+      multi_instructions += stepped;
+    }
+    multi_time += now() - start;
+    vector_instructions += m->vector_instructions;
+
+    for (uint8_t l = 0; l < MULTI_LANES; l++) {
+      store_lane(m, l);
+      same = same && same_cpu_state(separate[l], lanes[l]);
+      destroy_state(separate[l]);
+      destroy_state(lanes[l]);
+    }
+    free_multi_state(m);
+  }
+
+  fprintf(stderr, "core: multi (cpu only) lanes: %d instructions: %lu seconds: %f instructions/sec: %.0f vectorized: %.1f%% same as fast core: %s\n",
+          MULTI_LANES, multi_instructions, multi_time, multi_instructions / multi_time,
+          100.0 * vector_instructions / multi_instructions, same ? "yes" : "no");
+  fprintf(stderr, "core: fast (cpu only) states: %d instructions: %lu seconds: %f instructions/sec: %.0f\n",
+          MULTI_LANES, separate_instructions, separate_time, separate_instructions / separate_time);
+  return same ? 0 : EXIT_FAILURE;
+}
+
+// One instruction repeated through all of PRG-ROM, for the per opcode benchmark (-o)
+typedef struct OPCODE_CASE {
+  const char *name;
+  uint8_t bytes[3];
+  uint8_t size;
+  uint8_t x, y;
+  bool jump_to_next; // JMP/JSR, the operand is patched to the next copy
+} opcode_case;
+
+// Zero page pointers used by the indirect cases: $10 -> $0200, $12 -> $02F0.
+// Y = $20 moves $02F0 into the next page, Y = 1 doesn't. The SR after reset has Z clear.
+static const opcode_case opcode_cases[] = {
+  { "NOP", { 0xEA }, 1, 0, 0, false },
+  { "LDA #imm", { 0xA9, 0x42 }, 2, 0, 0, false },
+  { "LDA zp", { 0xA5, 0x10 }, 2, 0, 0, false },
+  { "LDA zp,X", { 0xB5, 0x10 }, 2, 1, 0, false },
+  { "LDA abs", { 0xAD, 0x00, 0x02 }, 3, 0, 0, false },
+  { "LDA abs,X", { 0xBD, 0x00, 0x02 }, 3, 1, 0, false },
+  { "LDA abs,X page cross", { 0xBD, 0xF0, 0x02 }, 3, 0x20, 0, false },
+  { "LDA abs,Y page cross", { 0xB9, 0xF0, 0x02 }, 3, 0, 0x20, false },
+  { "LDA (zp,X)", { 0xA1, 0x10 }, 2, 0, 0, false },
+  { "LDA (zp),Y", { 0xB1, 0x12 }, 2, 0, 1, false },
+  { "LDA (zp),Y page cross", { 0xB1, 0x12 }, 2, 0, 0x20, false },
+  { "LDX #imm", { 0xA2, 0x01 }, 2, 0, 0, false },
+  { "LDY abs,X", { 0xBC, 0x00, 0x02 }, 3, 1, 0, false },
+  { "STA zp", { 0x85, 0x20 }, 2, 0, 0, false },
+  { "STA abs", { 0x8D, 0x00, 0x03 }, 3, 0, 0, false },
+  { "STA abs,X", { 0x9D, 0x00, 0x03 }, 3, 1, 0, false },
+  { "STA (zp),Y", { 0x91, 0x10 }, 2, 0, 1, false },
+  { "ADC #imm", { 0x69, 0x01 }, 2, 0, 0, false },
+  { "ADC zp", { 0x65, 0x10 }, 2, 0, 0, false },
+  { "SBC #imm", { 0xE9, 0x01 }, 2, 0, 0, false },
+  { "AND #imm", { 0x29, 0x7F }, 2, 0, 0, false },
+  { "CMP #imm", { 0xC9, 0x42 }, 2, 0, 0, false },
+  { "BIT zp", { 0x24, 0x10 }, 2, 0, 0, false },
+  { "INX", { 0xE8 }, 1, 0, 0, false },
+  { "TAX", { 0xAA }, 1, 0, 0, false },
+  { "CLC", { 0x18 }, 1, 0, 0, false },
+  { "ASL A", { 0x0A }, 1, 0, 0, false },
+  { "ROR A", { 0x6A }, 1, 0, 0, false },
+  { "INC zp", { 0xE6, 0x20 }, 2, 0, 0, false },
+  { "DEC zp,X", { 0xD6, 0x20 }, 2, 1, 0, false },
+  { "INC abs", { 0xEE, 0x00, 0x03 }, 3, 0, 0, false },
+  { "INC abs,X", { 0xFE, 0x00, 0x03 }, 3, 1, 0, false },
+  { "ASL abs,X", { 0x1E, 0x00, 0x03 }, 3, 1, 0, false },
+  { "LSR zp", { 0x46, 0x20 }, 2, 0, 0, false },
+  { "BNE taken", { 0xD0, 0x00 }, 2, 0, 0, false },
+  { "BEQ not taken", { 0xF0, 0x00 }, 2, 0, 0, false },
+  { "JMP abs", { 0x4C }, 3, 0, 0, true },
+  { "JSR abs", { 0x20 }, 3, 0, 0, true },
+  { "PHA", { 0x48 }, 1, 0, 0, false },
+  { "PLA", { 0x68 }, 1, 0, 0, false },
+  { "PHP", { 0x08 }, 1, 0, 0, false },
+  { "LAX zp", { 0xA7, 0x10 }, 2, 0, 0, false },
+  { "DCP abs,X", { 0xDF, 0x00, 0x03 }, 3, 1, 0, false },
+};
+
+// A mapper 0 rom with the instruction of c repeated from $8000, and a JMP back at the end
+static nes_rom *opcode_rom(const opcode_case *c) {
+  uint8_t *prg = calloc(0x8000, 1);
+  uint16_t addr = 0x8000;
+  while (addr + c->size <= 0xFFF0 - 3) {
+    memcpy(&prg[addr - 0x8000], c->bytes, c->size);
+    if (c->jump_to_next) {
+      prg[addr - 0x8000 + 1] = (addr + 3) & 0xFF;
+      prg[addr - 0x8000 + 2] = (addr + 3) >> 8;
+    }
+    addr += c->size;
+  }
+  prg[addr - 0x8000] = 0x4C;
+  prg[addr - 0x8000 + 1] = 0x00;
+  prg[addr - 0x8000 + 2] = 0x80;
+  // NMI, reset and IRQ
+  for (uint16_t vector = 0xFFFA; vector != 0; vector += 2) {
+    prg[vector - 0x8000] = 0x00;
+    prg[vector - 0x8000 + 1] = 0x80;
+  }
+  nes_rom *rom = calloc(1, sizeof(nes_rom));
+  rom->prg_rom_size = 2;
+  rom->chr_rom_size = 1;
+  rom->prg_rom = prg;
+  rom->chr_rom = calloc(0x2000, 1);
+  return rom;
+}
+
+static nes_state *start_opcode_state(const opcode_case *c) {
+  nes_state *state = init_state();
+  attach_rom(state, opcode_rom(c));
+  reset(state);
+  state->cpu->registers->X = c->x;
+  state->cpu->registers->Y = c->y;
+  state->memory[0x10] = 0x00;
+  state->memory[0x11] = 0x02;
+  state->memory[0x12] = 0xF0;
+  state->memory[0x13] = 0x02;
+  return state;
+}
+
+// Every opcode case on its own, cpu only, one tab separated line per case for comparing runs
+static int bench_opcodes(uint8_t core, uint32_t runs, uint32_t cycles_per_run) {
+  fprintf(stderr, "core\tdispatch\tflags\tcase\topcode\tcycles/instruction\tcycles\tseconds\tns/cycle\n");
+  for (size_t i = 0; i < sizeof(opcode_cases) / sizeof(opcode_cases[0]); i++) {
+    const opcode_case *c = &opcode_cases[i];
+    // Cycles of one copy, untimed, to show the case takes the path it is named after
+    nes_state *probe = start_opcode_state(c);
+    uint64_t probe_start = probe->cpu->cpu_cycle;
+    for (uint32_t n = 0; n < 1000; n++) {
+      cpu_fast_step(probe);
+    }
+    double cycles_per_instruction = (probe->cpu->cpu_cycle - probe_start) / 1000.0;
+    destroy_state(probe);
+
+    uint64_t total_cycles = 0;
+    double total_time = 0;
+    for (uint32_t run = 0; run < runs; run++) {
+      nes_state *state = start_opcode_state(c);
+
+      uint64_t start_cycle = state->cpu->cpu_cycle;
+      double start = now();
+      while (state->cpu->cpu_cycle - start_cycle < cycles_per_run && !state->fatal_error) {
+        if (core == FAST_CORE) {
+          cpu_fast_step(state);
+        }
+        else {
+          cpu_step(state);
+        }
+      }
+      total_time += now() - start;
+      total_cycles += state->cpu->cpu_cycle - start_cycle;
+      bool failed = state->fatal_error;
+      destroy_state(state);
+      if (failed) {
+        fprintf(stderr, "%s: fatal error\n", c->name);
+        return EXIT_FAILURE;
+      }
+    }
+    fprintf(stderr, "%s\t%s\t%s\t%s\t%02X\t%.2f\t%lu\t%f\t%.2f\n", core_names[core], DISPATCH_NAME, FLAGS_NAME,
+            c->name, c->bytes[0], cycles_per_instruction, total_cycles, total_time, 1e9 * total_time / total_cycles);
+  }
+  return 0;
+}
+
+// read_mem and write_mem as they were before the page table, range tests in order,
+// for -u. Only the RAM and PRG-ROM paths, the io accesses are not part of the benchmark.
+__attribute__((noinline)) static uint8_t chain_read_mem(nes_state *state, uint16_t memloc) {
+  if (memloc >= 0x8000) {
+    uint16_t translated = memloc - 0x8000;
+    if (translated < 0x4000) {
+      return state->rom->prg_rom[translated];
+    }
+    return state->rom->prg_rom[(state->rom->prg_rom_size - 1) * 0x4000 + translated - 0x4000];
+  }
+  if (memloc < 0x2000) {
+    return state->memory[memloc & 0x7FF];
+  }
+  return read_io(state, memloc);
+}
+
+__attribute__((noinline)) static void chain_write_mem(nes_state *state, uint16_t memloc, uint8_t value) {
+  if (memloc >= 0x8000) {
+    state->fatal_error = true;
+    state->running = false;
+    return;
+  }
+  if (memloc < 0x2000) {
+    state->memory[memloc & 0x7FF] = value;
+    return;
+  }
+  write_io(state, memloc, value);
+}
+
+#define BUS_ADDRESSES 4096
+
+// Addresses like the ones a game touches: mostly zero page and stack, then the rest of RAM and
+// its mirrors, and PRG-ROM (not written). Always the same pseudo random sequence.
+static void bus_addresses(uint16_t *reads, uint16_t *writes) {
+  uint32_t seed = 12345;
+  for (int i = 0; i < BUS_ADDRESSES; i++) {
+    seed = seed * 1103515245 + 12345;
+    uint32_t r = seed >> 8;
+    uint16_t ram;
+    switch (r % 10) {
+    case 0: case 1: case 2: case 3: ram = (r >> 4) & 0xFF; break;
+    case 4: case 5: ram = 0x100 | ((r >> 4) & 0xFF); break;
+    default: ram = (r >> 4) & 0x1FFF; break;
+    }
+    writes[i] = ram;
+    reads[i] = r % 4 == 0 ? 0x8000 | ((r >> 4) & 0x7FFF) : ram;
+  }
+}
+
+// The bus on its own: the same reads and writes through read_mem/write_mem and the old if-chain
+static int bench_bus(uint32_t runs) {
+  nes_state *state = start_opcode_state(&opcode_cases[0]);
+  uint16_t reads[BUS_ADDRESSES], writes[BUS_ADDRESSES];
+  bus_addresses(reads, writes);
+  uint64_t accesses = (uint64_t) runs * 100 * BUS_ADDRESSES;
+  volatile uint8_t sink = 0;
+  for (int path = 0; path < 2; path++) {
+    uint8_t sum = 0;
+    double start = now();
+    for (uint32_t n = 0; n < runs * 100; n++) {
+      for (int i = 0; i < BUS_ADDRESSES; i++) {
+        sum += path == 0 ? read_mem(state, reads[i]) : chain_read_mem(state, reads[i]);
+      }
+    }
+    double read_time = now() - start;
+    start = now();
+    for (uint32_t n = 0; n < runs * 100; n++) {
+      for (int i = 0; i < BUS_ADDRESSES; i++) {
+        if (path == 0) {
+          write_mem(state, writes[i], sum + i);
+        }
+        else {
+          chain_write_mem(state, writes[i], sum + i);
+        }
+      }
+    }
+    double write_time = now() - start;
+    sink = sum;
+    fprintf(stderr, "bus: %s accesses: %lu read seconds: %f ns/read: %.2f write seconds: %f ns/write: %.2f\n",
+            path == 0 ? "page table" : "if-chain", accesses, read_time, 1e9 * read_time / accesses,
+            write_time, 1e9 * write_time / accesses);
+  }
+  (void) sink;
+  bool failed = state->fatal_error;
+  destroy_state(state);
+  return failed ? EXIT_FAILURE : 0;
+}
+
+int main(int argc, char **argv) {
+  int opt;
+  uint8_t core = CYCLE_CORE;
+  uint32_t runs = 200;
+  uint32_t cycles_per_run = 26000;
+  bool cpu_only = false;
+  bool skip_idle_loops = false;
+  bool multi = false;
+  bool opcodes = false;
+  bool bus = false;
+  while ((opt = getopt(argc, argv, "fymopuin:c:")) != -1) {
+    switch (opt) {
+    case 'f':
+      core = FAST_CORE;
+      break;
+    case 'y':
+      core = SYNC_CORE;
+      break;
+    case 'm':
+      multi = true;
+      break;
+    case 'o':
+      opcodes = true;
+      break;
+    case 'u':
+      bus = true;
+      break;
+    case 'p':
+      cpu_only = true;
+      break;
+    case 'i':
+      skip_idle_loops = true;
+      break;
+    case 'n':
+      runs = (uint32_t) strtol(optarg, NULL, 10);
+      break;
+    case 'c':
+      cycles_per_run = (uint32_t) strtol(optarg, NULL, 10);
+      break;
+    default:
+      fprintf(stderr, "Usage: %s [-f|-y|-m] [-o] [-p] [-u] [-i] [-n runs] [-c cycles] [rom]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  char *filename = optind < argc ? argv[optind] : "test/nestest.nes";
+  if (bus) {
+    return bench_bus(runs);
+  }
+  if (multi) {
+    return bench_multi(filename, runs, cycles_per_run);
+  }
+  if ((cpu_only || opcodes) && core == SYNC_CORE) {
+    fprintf(stderr, "-p and -o are only supported by the cycle and fast core\n");
+    return EXIT_FAILURE;
+  }
+  if (opcodes) {
+    return bench_opcodes(core, runs, cycles_per_run);
+  }
+
+  uint64_t total_cycles = 0;
+  double total_time = 0;
+  for (uint32_t run = 0; run < runs; run++) {
+    // Set up a fresh console for every run, outside of the timing
+    nes_state *state = start_state(filename);
+    if (state == NULL) {
+      return EXIT_FAILURE;
+    }
+    state->core = core;
+    if (skip_idle_loops) {
+      enable_idle_loop_skipping(state);
+    }
+
+    uint64_t start_cycle = state->cpu->cpu_cycle;
+    double start = now();
+    while (state->cpu->cpu_cycle - start_cycle < cycles_per_run && !state->fatal_error) {
+      if (!cpu_only) {
+        step_core(state, cycles_per_run - (state->cpu->cpu_cycle - start_cycle));
+      }
+      else if (core == FAST_CORE) {
+        cpu_fast_step(state);
+      }
+      else {
+        cpu_step(state);
+      }
+    }
+    total_time += now() - start;
+    total_cycles += state->cpu->cpu_cycle - start_cycle;
+
+    destroy_state(state);
+  }
+
+  fprintf(stderr, "core: %s%s%s dispatch: %s flags: %s cycles: %lu seconds: %f cycles/sec: %.0f\n",
+          core_names[core], cpu_only ? " (cpu only)" : "", skip_idle_loops ? " (idle loops skipped)" : "", DISPATCH_NAME, FLAGS_NAME,
+          total_cycles, total_time, total_cycles / total_time);
+  return 0;
+}
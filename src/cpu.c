@@ -4,6 +4,9 @@
 #include "nes.h"
 #include "logger.h"
 #include "memory.h"
+#include "microcode.h"
+#include "decode_cache.h"
+#include "interrupt.h"
 
 
 void init_registers(registers *regs) {
@@ -20,6 +23,7 @@ void init_registers(registers *regs) {
 
 void print_status_reg(nes_state *state) {
     // nv1bdizc
+    build_status_reg(state);
     uint8_t status = state->cpu->registers->SR;
     if ((status & 128) == 128) { printf("N"); } else { printf("n"); }
     if ((status & 64) == 64) { printf("V"); } else { printf("v"); }
@@ -32,6 +36,7 @@ void print_status_reg(nes_state *state) {
 }
 
 void print_regs(nes_state *state) {
+    build_status_reg(state);
     printf("\x1b[1;31mACC: \x1b[0m0x%02x\n\x1b[1;32mX: \x1b[0m  0x%02x\n\x1b[1;33mY: \x1b[0m  0x%02x\n\x1b[1;34mSP: \x1b[0m 0x%04x\n\x1b[1;35mPC:\x1b[0m  0x%04x\n\x1b[1;36mFlags: \x1b[0m0x%02x - ",
 	   state->cpu->registers->ACC,
 	   state->cpu->registers->X,
@@ -62,10 +67,10 @@ void print_stack(nes_state *state) {
     /* int start = end - 10; */
     for (int i = 10; i >= 0; i--) {
 	if ((uint8_t) end - i == state->cpu->registers->SP) {
-	    printf("%s%04X\t%02X\n", spline, end - i + offset, read_mem(state, end - i + offset));
+	    printf("%s%04X\t%02X\n", spline, end - i + offset, peek_mem(state, end - i + offset));
 	}
 	else {
-	    printf("%s%04X\t%02X\n", space, end - i + offset, read_mem(state, end - i + offset));
+	    printf("%s%04X\t%02X\n", space, end - i + offset, peek_mem(state, end - i + offset));
 	}
     }
 }
@@ -75,15 +80,17 @@ void print_stack(nes_state *state) {
 void set_pc(nes_state *state, unsigned short pc) {
     state->cpu->registers->PC = pc;
     state->cpu->current_opcode_PC = pc;
-    state->cpu->current_opcode = read_mem(state, pc);
+    state->cpu->current_opcode = peek_mem(state, pc);
 }
 
 void set_negative_flag(nes_state *state) {
     state->cpu->registers->SR |= 128;
+    state->cpu->lazy_flags &= ~128;
 }
 
 void set_overflow_flag(nes_state *state) {
     state->cpu->registers->SR |= 64;
+    state->cpu->lazy_flags &= ~64;
 }
 
 
@@ -102,18 +109,22 @@ void set_interrupt_flag(nes_state *state) {
 
 void set_zero_flag(nes_state *state) {
     state->cpu->registers->SR |= 2;
+    state->cpu->lazy_flags &= ~2;
 }
 
 void set_carry_flag(nes_state *state) {
     state->cpu->registers->SR |= 1;
+    state->cpu->lazy_flags &= ~1;
 }
 
 void clear_negative_flag(nes_state *state) {
     state->cpu->registers->SR &= 127;
+    state->cpu->lazy_flags &= ~128;
 }
 
 void clear_overflow_flag(nes_state *state) {
     state->cpu->registers->SR &= (255-64);
+    state->cpu->lazy_flags &= ~64;
 }
 
 
@@ -132,43 +143,224 @@ void clear_interrupt_flag(nes_state *state) {
 
 void clear_zero_flag(nes_state *state) {
     state->cpu->registers->SR &= (255-2);
+    state->cpu->lazy_flags &= ~2;
 }
 
 void clear_carry_flag(nes_state *state) {
     state->cpu->registers->SR &= (255-1);
+    state->cpu->lazy_flags &= ~1;
 }
 
 
 bool is_carry_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 1) == 1);
 }
 bool is_zero_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 2) == 2);
 }
 bool is_interrupt_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 4) == 4);
 }
 bool is_decimal_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 8) == 8);
 }
 bool is_break_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 16) == 16);
 }
 bool is_overflow_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 64) == 64);
 }
 bool is_negative_flag_set(nes_state *state) {
+    build_status_reg(state);
     return ((state->cpu->registers->SR & 128) == 128);
 }
 
 
 
+// Flags computed from the result of an instruction.
+// Build with -DLAZY_FLAGS to only store the result here, and compute N, Z, C and V
+// when something reads the status register (build_status_reg). In the default build
+// the flags are written straight away. lazy_flags holds the bits of SR that are stale.
+void set_nz_from_result(nes_state *state, uint8_t result) {
+#ifdef LAZY_FLAGS
+    state->cpu->nz_result = result;
+    state->cpu->lazy_flags |= 128 | 2;
+#else
+    state->cpu->registers->SR &= (255-128-2);
+    if (result == 0) { state->cpu->registers->SR |= 2; }
+    state->cpu->registers->SR |= result & 128;
+#endif
+}
+
+// Carry is bit 8 of result
+void set_carry_from_result(nes_state *state, uint16_t result) {
+#ifdef LAZY_FLAGS
+    state->cpu->carry_result = result;
+    state->cpu->lazy_flags |= 1;
+#else
+    state->cpu->registers->SR = (state->cpu->registers->SR & (255-1)) | ((result >> 8) & 1);
+#endif
+}
+
+// Overflow is bit 7 of result
+void set_overflow_from_result(nes_state *state, uint8_t result) {
+#ifdef LAZY_FLAGS
+    state->cpu->overflow_result = result;
+    state->cpu->lazy_flags |= 64;
+#else
+    state->cpu->registers->SR = (state->cpu->registers->SR & (255-64)) | ((result >> 1) & 64);
+#endif
+}
+
+// Bring SR up to date. Call before reading SR directly.
+void build_status_reg(nes_state *state) {
+    uint8_t lazy = state->cpu->lazy_flags;
+    if (lazy == 0) { return; }
+    uint8_t status = state->cpu->registers->SR & ~lazy;
+    if ((lazy & 128) == 128) { status |= state->cpu->nz_result & 128; }
+    if ((lazy & 64) == 64) { status |= (state->cpu->overflow_result >> 1) & 64; }
+    if ((lazy & 2) == 2 && state->cpu->nz_result == 0) { status |= 2; }
+    if ((lazy & 1) == 1) { status |= (state->cpu->carry_result >> 8) & 1; }
+    state->cpu->registers->SR = status;
+    state->cpu->lazy_flags = 0;
+}
+
+
 // Push a value to the stack
 void push(nes_state *state, uint8_t value) {
-    write_mem(state, state->cpu->registers->SP + 0x100, value);
+    write_stack(state, value);
     state->cpu->registers->SP--;;
 }
 
+// Build with -DTHREADED_DISPATCH (GCC only) to thread the actions run by run_actions: every handler
+// ends with a jump straight to the handler of the next action of the program, through a table of
+// label addresses ("computed goto"), instead of going back to the switch.
+#if defined(THREADED_DISPATCH) && defined(__GNUC__)
+// Every handler is both a case of the switch and a label for the threaded dispatch
+#define ACTION(name) case name: action_##name
+#define NEXT_ACTION do {					\
+	if (more == 0) { return; }				\
+	more--;							\
+	action = next_program_action(state);			\
+	goto *action_labels[action];				\
+    } while (0)
+// GCC does not inline a function that takes the address of its labels
+#define RUN_ACTIONS_INLINE
+#else
+#undef THREADED_DISPATCH
+#define ACTION(name) case name
+#define NEXT_ACTION break
+#define RUN_ACTIONS_INLINE __attribute__((always_inline)) inline
+#endif
+
+// Actions that exist once per register, like LDA/LDX/LDY or indexing with X and Y.
+// Every handler passes its register to one of these, so the register is known at compile time
+// instead of being looked up through a pointer set when the instruction starts.
+#define REG(name) (state->cpu->registers->name)
+#define ZEROPAGE_MEMORY (state->memory[state->cpu->low_addr_byte])
+
+#define FETCH_VALUE_SAVE_TO(reg) do {					\
+	reg = fetch_pc(state);		\
+	state->cpu->registers->PC++;					\
+	set_nz_from_result(state, reg);					\
+    } while (0)
+
+#define WRITE_TO_EFF_ADDR_ZEROPAGE(reg) (ZEROPAGE_MEMORY = reg)
+
+#define WRITE_TO_EFF_ADDR_NON_ZEROPAGE(reg)				\
+    write_mem(state, state->cpu->high_addr_byte << 8 | state->cpu->low_addr_byte, reg)
+
+#define READ_EFF_ADDR_STORE_IN(reg) do {				\
+	reg = read_mem(state, state->cpu->high_addr_byte << 8 | state->cpu->low_addr_byte); \
+	set_nz_from_result(state, reg);					\
+    } while (0)
+
+#define READ_ZEROPAGE_STORE_IN(reg) do {				\
+	reg = read_zp(state, state->cpu->low_addr_byte);		\
+	set_nz_from_result(state, reg);					\
+    } while (0)
+
+#define INCREMENT(reg) do { reg++; set_nz_from_result(state, reg); } while (0)
+#define DECREMENT(reg) do { reg--; set_nz_from_result(state, reg); } while (0)
+#define COPY_AFFECT_NZ_FLAGS(source, destination) do {			\
+	destination = source;						\
+	set_nz_from_result(state, destination);				\
+    } while (0)
+
+/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
+/* Compare sets flags as if a subtraction had been carried out. */
+/* If the value in the register is equal or greater than the compared value, */
+/* the Carry will be set. */
+#define COMPARE_MEMORY(reg) do {					\
+	uint8_t value = read_mem(state, ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte); \
+	set_nz_from_result(state, (uint8_t) (reg - value));		\
+	/* Carry is set when there is no borrow */			\
+	set_carry_from_result(state, (uint16_t) reg + (uint8_t) ~value + 1); \
+    } while (0)
+
+#define ZEROPAGE_ADD(reg) do {						\
+	state->cpu->low_addr_byte += reg;				\
+	state->cpu->high_addr_byte = 0;					\
+    } while (0)
+
+// Fix high address, one cycle early
+#define FETCH_EFF_ADDR_HIGH_ADD_INC_PC_NO_EXTRA_CYCLES(reg) do {	\
+	state->cpu->high_addr_byte = fetch_pc(state); \
+	if (((uint16_t) state->cpu->low_addr_byte + (uint16_t) reg) > 0xFF) { \
+	    state->cpu->high_addr_byte++;				\
+	}								\
+	state->cpu->low_addr_byte += reg;				\
+	state->cpu->registers->PC++;					\
+    } while (0)
+
+// Same, and add a stall cycle if page boundary is crossed
+#define FETCH_EFF_ADDR_HIGH_ADD_INC_PC(reg) do {			\
+	if (((uint16_t) state->cpu->low_addr_byte + (uint16_t) reg) > 0xFF) { \
+	    add_stall_cycle(state);					\
+	}								\
+	FETCH_EFF_ADDR_HIGH_ADD_INC_PC_NO_EXTRA_CYCLES(reg);		\
+    } while (0)
+
+#define LSR_REG(reg) do {						\
+	set_carry_from_result(state, (uint16_t) reg << 8);		\
+	reg = reg >> 1;							\
+	set_nz_from_result(state, reg);					\
+    } while (0)
+
+#define ASL_REG(reg) do {						\
+	set_carry_from_result(state, (uint16_t) reg << 1);		\
+	reg = reg << 1;							\
+	set_nz_from_result(state, reg);					\
+    } while (0)
+
+#define ROR_REG(reg) do {						\
+	uint8_t newval = reg;						\
+	bool carry = is_carry_flag_set(state);				\
+	uint8_t lsb = newval & 1;					\
+	newval = newval >> 1;						\
+	if (carry) { newval |= 0x80; }					\
+	set_carry_from_result(state, (uint16_t) lsb << 8);		\
+	set_nz_from_result(state, newval);				\
+	reg = newval;							\
+    } while (0)
+
+#define ROL_REG(reg) do {						\
+	uint8_t newval = reg;						\
+	bool carry = is_carry_flag_set(state);				\
+	uint8_t msb = newval & 0x80;					\
+	newval = newval << 1;						\
+	if (carry) { newval |= 0x1; }					\
+	set_carry_from_result(state, (uint16_t) msb << 1);		\
+	set_nz_from_result(state, newval);				\
+	reg = newval;							\
+    } while (0)
+
 // Instructions take 2-8 cycles.
 // Each cycle is either a READ or a WRITE cycle - never both
 // an instruction is a set of "actions" executed serially
@@ -178,87 +370,244 @@ void push(nes_state *state, uint8_t value) {
 /*       2    PC     R  fetch low address byte, increment PC */
 /*       3    PC     R  copy low address byte to PCL, fetch high address */
 /*       byte to PCH */
-void execute_next_action(nes_state *state) {
-    switch (state->cpu->action_queue[state->cpu->next_action]) {
+// End the cycle of the action that just ran and count the next one like step_synced does.
+// Returns the next action of the program.
+static inline uint8_t next_program_action(nes_state *state) {
+    state->cpu->cpu_cycle++;
+    state->master_clock += 1;
+    state->ppu->pending_dots += 3;
+    return state->cpu->program[state->cpu->next_action++];
+}
+
+// Run action, and then the next "more" actions of the program, each in a cycle of its own.
+// The cycle core runs one action at a time, the synced core the actions of an instruction up to
+// the last one in one go (see execute_program_actions).
+static RUN_ACTIONS_INLINE void run_actions(nes_state *state, uint8_t action, uint8_t more) {
+#ifdef THREADED_DISPATCH
+#define LABEL(name) [name] = &&action_##name
+    static void *const action_labels[NUMBER_OF_ACTIONS] = {
+	LABEL(STALL_CYCLE),
+	LABEL(FETCH_OPCODE_INC_PC),
+	LABEL(FETCH_LOW_ADDR_BYTE_INC_PC),
+	LABEL(FETCH_HIGH_ADDR_BYTE_INC_PC),
+	LABEL(COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH),
+	LABEL(FETCH_VALUE_SAVE_TO_ACC),
+	LABEL(FETCH_VALUE_SAVE_TO_X),
+	LABEL(FETCH_VALUE_SAVE_TO_Y),
+	LABEL(WRITE_ACC_TO_EFF_ADDR_ZEROPAGE),
+	LABEL(WRITE_X_TO_EFF_ADDR_ZEROPAGE),
+	LABEL(WRITE_Y_TO_EFF_ADDR_ZEROPAGE),
+	LABEL(PUSH_PCH_DEC_S),
+	LABEL(PUSH_PCL_DEC_S),
+	LABEL(FETCH_OPERAND_INC_PC),
+	LABEL(ADD_OPERAND_TO_PCL),
+	LABEL(INC_PC),
+	LABEL(INC_SP),
+	LABEL(INC_X),
+	LABEL(INC_Y),
+	LABEL(DEC_X),
+	LABEL(DEC_Y),
+	LABEL(READ_EFF_ADDR_DUMMY_WRITE),
+	LABEL(INC_MEMORY),
+	LABEL(DEC_MEMORY),
+	LABEL(BIT_READ_AFFECT_FLAGS),
+	LABEL(PULL_PCL_FROM_STACK_INC_SP),
+	LABEL(PULL_PCH_FROM_STACK),
+	LABEL(PULL_ACC_FROM_STACK_AFFECT_FLAGS),
+	LABEL(PUSH_ACC_DEC_SP),
+	LABEL(PULL_STATUS_REG_FROM_STACK_PLP),
+	LABEL(PUSH_STATUS_REG_DEC_SP),
+	LABEL(PULL_STATUS_REG_FROM_STACK_RTI),
+	LABEL(CLEAR_CARRY_FLAG),
+	LABEL(CLEAR_ZERO_FLAG),
+	LABEL(CLEAR_INTERRUPT_FLAG),
+	LABEL(CLEAR_DECIMAL_FLAG),
+	LABEL(CLEAR_BREAK_FLAG),
+	LABEL(CLEAR_OVERFLOW_FLAG),
+	LABEL(CLEAR_NEGATIVE_FLAG),
+	LABEL(SET_CARRY_FLAG),
+	LABEL(SET_ZERO_FLAG),
+	LABEL(SET_INTERRUPT_FLAG),
+	LABEL(SET_DECIMAL_FLAG),
+	LABEL(SET_BREAK_FLAG),
+	LABEL(SET_OVERFLOW_FLAG),
+	LABEL(SET_NEGATIVE_FLAG),
+	LABEL(COPY_ACC_TO_X_AFFECT_NZ_FLAGS),
+	LABEL(COPY_ACC_TO_Y_AFFECT_NZ_FLAGS),
+	LABEL(COPY_SP_TO_X_AFFECT_NZ_FLAGS),
+	LABEL(COPY_X_TO_ACC_AFFECT_NZ_FLAGS),
+	LABEL(COPY_Y_TO_ACC_AFFECT_NZ_FLAGS),
+	LABEL(COPY_X_TO_SP_NO_FLAGS),
+	LABEL(WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE),
+	LABEL(WRITE_X_TO_EFF_ADDR_NON_ZEROPAGE),
+	LABEL(WRITE_Y_TO_EFF_ADDR_NON_ZEROPAGE),
+	LABEL(READ_EFF_ADDR_STORE_IN_ACC_AFFECT_NZ_FLAGS),
+	LABEL(READ_EFF_ADDR_STORE_IN_X_AFFECT_NZ_FLAGS),
+	LABEL(READ_EFF_ADDR_STORE_IN_Y_AFFECT_NZ_FLAGS),
+	LABEL(READ_ZEROPAGE_STORE_IN_ACC_AFFECT_NZ_FLAGS),
+	LABEL(READ_ZEROPAGE_STORE_IN_X_AFFECT_NZ_FLAGS),
+	LABEL(READ_ZEROPAGE_STORE_IN_Y_AFFECT_NZ_FLAGS),
+	LABEL(READ_ADDR_ADD_X_STORE_IN_OPERAND),
+	LABEL(FETCH_EFF_ADDR_LOW),
+	LABEL(FETCH_EFF_ADDR_HIGH),
+	LABEL(FETCH_EFF_ADDR_HIGH_ADD_Y),
+	LABEL(FETCH_ZP_PTR_ADDR_INC_PC),
+	LABEL(FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC),
+	LABEL(FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC),
+	LABEL(READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_ACC),
+	LABEL(READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_Y),
+	LABEL(FETCH_HIGH_BYTE_ADDR_ADD_Y),
+	LABEL(ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE),
+	LABEL(FETCH_LOW_ADDR_TO_LATCH),
+	LABEL(FETCH_PCH_COPY_LATCH_TO_PCL),
+	LABEL(AND_IMM_INC_PC),
+	LABEL(CMP_IMM_INC_PC),
+	LABEL(ORA_IMM_INC_PC),
+	LABEL(EOR_IMM_INC_PC),
+	LABEL(ADC_IMM_INC_PC),
+	LABEL(CPY_IMM_INC_PC),
+	LABEL(CPX_IMM_INC_PC),
+	LABEL(SBC_IMM_INC_PC),
+	LABEL(LSR_ACC),
+	LABEL(LSR_ZEROPAGE),
+	LABEL(ASL_ACC),
+	LABEL(ASL_ZEROPAGE),
+	LABEL(ROR_ACC),
+	LABEL(ROR_ZEROPAGE),
+	LABEL(ROL_ACC),
+	LABEL(ROL_ZEROPAGE),
+	LABEL(LSR_MEMORY),
+	LABEL(ASL_MEMORY),
+	LABEL(ROR_MEMORY),
+	LABEL(ROL_MEMORY),
+	LABEL(ORA_MEMORY),
+	LABEL(AND_MEMORY),
+	LABEL(EOR_MEMORY),
+	LABEL(ADC_MEMORY),
+	LABEL(SBC_MEMORY),
+	LABEL(CMP_MEMORY),
+	LABEL(CPX_MEMORY),
+	LABEL(CPY_MEMORY),
+	LABEL(ZEROPAGE_ADD_X),
+	LABEL(ZEROPAGE_ADD_Y),
+	LABEL(FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES),
+	LABEL(FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES),
+	LABEL(NOP_ABSOLUTE_X_MAYBE_STALL),
+	LABEL(LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS),
+	LABEL(SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS),
+	LABEL(DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY),
+	LABEL(FIX_HIGH_BYTE_NO_WRITE),
+	LABEL(FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE),
+	LABEL(ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY),
+	LABEL(INTERRUPT_FETCH_PCL),
+	LABEL(INTERRUPT_FETCH_PCH),
+	LABEL(BRK_FETCH_PCL),
+	LABEL(BRK_FETCH_PCH),
+	LABEL(PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG),
+	LABEL(PUSH_STATUS_REG_DEC_S_SET_B_FLAG),
+	LABEL(SLO_DO_ASL_THEN_ORA),
+	LABEL(RLA_DO_ROL_THEN_AND),
+	LABEL(SRE_DO_LSR_THEN_EOR_ACC),
+	LABEL(RRA_DO_ROR_THEN_ADC),
+    };
+#undef LABEL
+    goto *action_labels[action];
+#endif
+ dispatch:
+    switch (action) {
 	// Dummy cycle, "do nothing"
-    case STALL_CYCLE:
-	break;
+    ACTION(STALL_CYCLE):
+	NEXT_ACTION;
 	/* R fetch opcode, increment PC - first cycle in all instructions*/
-    case FETCH_OPCODE_INC_PC:
-	state->cpu->current_opcode = read_mem(state, state->cpu->registers->PC);
+    ACTION(FETCH_OPCODE_INC_PC):
+	state->cpu->current_opcode = fetch_pc(state);
 	state->cpu->registers->PC++;
-	break;
+	NEXT_ACTION;
 	/* R  fetch low address byte, increment PC */
-    case FETCH_LOW_ADDR_BYTE_INC_PC:
-	state->cpu->low_addr_byte = read_mem(state, state->cpu->registers->PC);
+    ACTION(FETCH_LOW_ADDR_BYTE_INC_PC):
+	state->cpu->low_addr_byte = fetch_pc(state);
 	state->cpu->registers->PC++;
-	break;
+	NEXT_ACTION;
 	/* R  copy low address byte to PCL, fetch high address byte to PCH */
-    case COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH:
+    ACTION(COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH):
 	// Read the high address first to avoid overwriting PC (having to store it)
-	state->cpu->high_addr_byte = read_mem(state, state->cpu->registers->PC);
+	state->cpu->high_addr_byte = fetch_pc(state);
 	state->cpu->registers->PC =  ((uint16_t) state->cpu->low_addr_byte | (state->cpu->high_addr_byte << 8));
-	break;
+	NEXT_ACTION;
 	// fetch value, save to destination, increment PC, affect N and Z flags
-    case FETCH_VALUE_SAVE_TO_DEST:
-	*(state->cpu->destination_reg) = read_mem(state, state->cpu->registers->PC);
-	state->cpu->registers->PC++;
-	if (*state->cpu->destination_reg == 0) { set_zero_flag(state); }
-	else { clear_zero_flag(state);}
-	if (*state->cpu->destination_reg >= 0x80) { set_negative_flag(state); }
-	else { clear_negative_flag(state); }
-	break;
+    ACTION(FETCH_VALUE_SAVE_TO_ACC):
+	FETCH_VALUE_SAVE_TO(REG(ACC));
+	NEXT_ACTION;
+    ACTION(FETCH_VALUE_SAVE_TO_X):
+	FETCH_VALUE_SAVE_TO(REG(X));
+	NEXT_ACTION;
+    ACTION(FETCH_VALUE_SAVE_TO_Y):
+	FETCH_VALUE_SAVE_TO(REG(Y));
+	NEXT_ACTION;
 
 	// W  write register to effective address - zeropage
-    case WRITE_REG_TO_EFF_ADDR_ZEROPAGE:
-	state->memory[state->cpu->low_addr_byte] = *(state->cpu->source_reg);
-	break;
+    ACTION(WRITE_ACC_TO_EFF_ADDR_ZEROPAGE):
+	WRITE_TO_EFF_ADDR_ZEROPAGE(REG(ACC));
+	NEXT_ACTION;
+    ACTION(WRITE_X_TO_EFF_ADDR_ZEROPAGE):
+	WRITE_TO_EFF_ADDR_ZEROPAGE(REG(X));
+	NEXT_ACTION;
+    ACTION(WRITE_Y_TO_EFF_ADDR_ZEROPAGE):
+	WRITE_TO_EFF_ADDR_ZEROPAGE(REG(Y));
+	NEXT_ACTION;
 
 	// W  push PCH on stack, decrement S
-    case PUSH_PCH_DEC_S:
+    ACTION(PUSH_PCH_DEC_S):
 	push(state, (uint8_t) (state->cpu->registers->PC >> 8));
-	break;
+	NEXT_ACTION;
 	// W  push PCL on stack, decrement S
-    case PUSH_PCL_DEC_S:
+    ACTION(PUSH_PCL_DEC_S):
 	push(state, (uint8_t) (state->cpu->registers->PC));
-	break;
+	NEXT_ACTION;
 	// fetch operand, increment PC
-    case FETCH_OPERAND_INC_PC:
-	state->cpu->operand = read_mem(state, state->cpu->registers->PC);
+    ACTION(FETCH_OPERAND_INC_PC):
+	state->cpu->operand = fetch_pc(state);
 	state->cpu->registers->PC++;
-	break;
+	NEXT_ACTION;
 
 	/* add operand to PCL. */
-    case ADD_OPERAND_TO_PCL:
+    ACTION(ADD_OPERAND_TO_PCL):
 	// Displacement for branches are signed 8 bit
     {
 	uint16_t old_pc = state->cpu->registers->PC;
 	state->cpu->registers->PC += (int8_t) state->cpu->operand;
 	// Figure out if branching to different page
 	if ((old_pc & 0xFF00) != (state->cpu->registers->PC & 0xFF00)) {
-	    add_action_to_queue(state, STALL_CYCLE);
+	    add_stall_cycle(state);
 	}
     }
-	break;
+	NEXT_ACTION;
 	/* increment PC. */
-    case INC_PC:
+    ACTION(INC_PC):
 	state->cpu->registers->PC++;
-	break;
+	NEXT_ACTION;
 
 
 	// Add an extra cycle if page boundary crossed in illegal *NOP absolute, X instructions
-    case NOP_ABSOLUTE_X_MAYBE_STALL:
+    ACTION(NOP_ABSOLUTE_X_MAYBE_STALL):
 
-	if (((uint16_t)state->cpu->low_addr_byte + (uint16_t)*state->cpu->index_reg) > 0xFF) {
+	if (((uint16_t)state->cpu->low_addr_byte + (uint16_t)state->cpu->registers->X) > 0xFF) {
 	    state->cpu->high_addr_byte++;
-	    add_action_to_queue(state, STALL_CYCLE);
+	    add_stall_cycle(state);
 	}
 
-	break;
+	NEXT_ACTION;
 
 	// BIT sets the Z flag as though the value in the address tested were ANDed with the accumulator.
 	// The N and V flags are set to match bits 7 and 6 respectively in the value stored at the tested address.
-    case BIT_READ_AFFECT_FLAGS:
+    ACTION(BIT_READ_AFFECT_FLAGS):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte;
 	uint8_t value = read_mem(state, addr);
@@ -267,40 +616,40 @@ void execute_next_action(nes_state *state) {
 	if ((value & 128) == 128) { set_negative_flag(state); } else {clear_negative_flag(state); }
 	if ((value & 64) == 64) { set_overflow_flag(state); } else {clear_overflow_flag(state); }
     }
-    break;
+    NEXT_ACTION;
     // Increment S (stack pointer)
-    case INC_SP:
+    ACTION(INC_SP):
 	state->cpu->registers->SP++;
-	break;
+	NEXT_ACTION;
 	// pull PCL from stack, increment S
-    case PULL_PCL_FROM_STACK_INC_SP:
+    ACTION(PULL_PCL_FROM_STACK_INC_SP):
 	state->cpu->registers->PC &= 0xFF00;
-	state->cpu->registers->PC |= (uint8_t) read_mem(state, state->cpu->registers->SP + 0x100);
+	state->cpu->registers->PC |= read_stack(state);
 	state->cpu->registers->SP++;
-	break;
+	NEXT_ACTION;
 	// pull PCH from stack
-    case PULL_PCH_FROM_STACK:
+    ACTION(PULL_PCH_FROM_STACK):
 	state->cpu->registers->PC &= 0x00FF;
-	state->cpu->registers->PC |= ((uint8_t) read_mem(state, state->cpu->registers->SP + 0x100) << 8);
-	break;
+	state->cpu->registers->PC |= (read_stack(state) << 8);
+	NEXT_ACTION;
 	// Pull ACC from stack (In PLA) and affect flags
-    case PULL_ACC_FROM_STACK_AFFECT_FLAGS:
-	state->cpu->registers->ACC = read_mem(state, state->cpu->registers->SP + 0x100);
-	if (state->cpu->registers->ACC == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (state->cpu->registers->ACC > 0x7f) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	break;
+    ACTION(PULL_ACC_FROM_STACK_AFFECT_FLAGS):
+	state->cpu->registers->ACC = read_stack(state);
+	set_nz_from_result(state, state->cpu->registers->ACC);
+	NEXT_ACTION;
 	// push ACC on stack, decrement S
-    case PUSH_ACC_DEC_SP:
-	state->memory[state->cpu->registers->SP + 0x100] = state->cpu->registers->ACC;
+    ACTION(PUSH_ACC_DEC_SP):
+	write_stack(state, state->cpu->registers->ACC);
 	state->cpu->registers->SP--;
-	break;
+	NEXT_ACTION;
 	// Pull Status register from stack (In PLP and RTI)
-    case PULL_STATUS_REG_FROM_STACK_PLP:
+    ACTION(PULL_STATUS_REG_FROM_STACK_PLP):
     {
 	// Two instructions (PLP and RTI) pull a byte from the stack and set all the flags. They ignore bits 5 and 4.
-	uint8_t value = read_mem(state, state->cpu->registers->SP + 0x100);
+	uint8_t value = read_stack(state);
 	// Ignore bits 4 and 5
 	value &= 0xcf;
+	build_status_reg(state);
 	uint8_t cur_flags = state->cpu->registers->SR;
 	// Keey bits 4 and 5
 	cur_flags &= 0x30;
@@ -308,30 +657,30 @@ void execute_next_action(nes_state *state) {
 	cur_flags |= value;
 	state->cpu->registers->SR = cur_flags;
     }
-    break;
+    NEXT_ACTION;
     // Push Status register to stack, decrement S
-    case PUSH_STATUS_REG_DEC_SP:
+    ACTION(PUSH_STATUS_REG_DEC_SP):
 	/* See this note about the B flag for explanation of the OR */
 	/* https://wiki.nesdev.com/w/index.php/Status_flags#The_B_flag */
-	state->memory[state->cpu->registers->SP + 0x100] = 48 | state->cpu->registers->SR;
+	build_status_reg(state);
+	write_stack(state, 48 | state->cpu->registers->SR);
 	state->cpu->registers->SP--;
-	break;
+	NEXT_ACTION;
 
 	// And immediate, increment PC
-    case AND_IMM_INC_PC:
+    ACTION(AND_IMM_INC_PC):
     {
-	uint8_t res = state->cpu->registers->ACC & (read_mem(state, state->cpu->registers->PC));
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	uint8_t res = state->cpu->registers->ACC & (fetch_pc(state));
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
 	state->cpu->registers->PC++;
     }
-    break;
+    NEXT_ACTION;
     // CMP immediate
-    case CMP_IMM_INC_PC:
+    ACTION(CMP_IMM_INC_PC):
     {
 	uint8_t acc = state->cpu->registers->ACC;
-	uint8_t value = read_mem(state, state->cpu->registers->PC);
+	uint8_t value = fetch_pc(state);
 	uint8_t res = acc - value;
 	/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
 	/* Compare sets flags as if a subtraction had been carried out. */
@@ -339,56 +688,51 @@ void execute_next_action(nes_state *state) {
 	/* the Carry will be set. */
 	/* The equal (Z) and negative (N) flags will be set based on equality or lack */
 	/* thereof and the sign (i.e. A>=$80) of the accumulator. */
-	if (acc == value) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (acc >= value) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (res >= 0x80)  { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
+	// Carry is set when there is no borrow
+	set_carry_from_result(state, (uint16_t) acc + (uint8_t) ~value + 1);
 	state->cpu->registers->PC++;
     }
 
-    break;
+    NEXT_ACTION;
     // ORA immediate, increment PC
-    case ORA_IMM_INC_PC:
+    ACTION(ORA_IMM_INC_PC):
     {
-	uint8_t res = state->cpu->registers->ACC | (read_mem(state, state->cpu->registers->PC));
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	uint8_t res = state->cpu->registers->ACC | (fetch_pc(state));
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
 	state->cpu->registers->PC++;
     }
-    break;
+    NEXT_ACTION;
     // EOR immediate, increment PC
-    case EOR_IMM_INC_PC:
+    ACTION(EOR_IMM_INC_PC):
     {
-	uint8_t res = state->cpu->registers->ACC ^ (read_mem(state, state->cpu->registers->PC));
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	uint8_t res = state->cpu->registers->ACC ^ (fetch_pc(state));
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
 	state->cpu->registers->PC++;
     }
-    break;
+    NEXT_ACTION;
     // ADC immediate, increment PC
-    case ADC_IMM_INC_PC:
+    ACTION(ADC_IMM_INC_PC):
     {
 	uint8_t acc = state->cpu->registers->ACC;
-	uint8_t value = read_mem(state, state->cpu->registers->PC);
+	uint8_t value = fetch_pc(state);
 	uint16_t res = ((uint16_t) acc) + ((uint16_t) value);
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
 	state->cpu->registers->ACC = (uint8_t) res;
 	state->cpu->registers->PC++;
     }
-    break;
+    NEXT_ACTION;
 
     // CPY Immediate
-    case CPY_IMM_INC_PC:
+    ACTION(CPY_IMM_INC_PC):
     {
 	uint8_t y = state->cpu->registers->Y;
-	uint8_t value = read_mem(state, state->cpu->registers->PC);
+	uint8_t value = fetch_pc(state);
 	uint8_t res = y - value;
 	/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
 	/* Compare sets flags as if a subtraction had been carried out. */
@@ -396,19 +740,19 @@ void execute_next_action(nes_state *state) {
 	/* the Carry will be set. */
 	/* The equal (Z) and negative (N) flags will be set based on equality or lack */
 	/* thereof and the sign (i.e. A>=$80) of the accumulator. */
-	if (y == value) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (y >= value) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (res >= 0x80)  { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
+	// Carry is set when there is no borrow
+	set_carry_from_result(state, (uint16_t) y + (uint8_t) ~value + 1);
 	state->cpu->registers->PC++;
     }
 
-    break;
+    NEXT_ACTION;
 
     // CPX Immediate
-    case CPX_IMM_INC_PC:
+    ACTION(CPX_IMM_INC_PC):
     {
 	uint8_t x = state->cpu->registers->X;
-	uint8_t value = read_mem(state, state->cpu->registers->PC);
+	uint8_t value = fetch_pc(state);
 	uint8_t res = x - value;
 	/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
 	/* Compare sets flags as if a subtraction had been carried out. */
@@ -416,39 +760,37 @@ void execute_next_action(nes_state *state) {
 	/* the Carry will be set. */
 	/* The equal (Z) and negative (N) flags will be set based on equality or lack */
 	/* thereof and the sign (i.e. A>=$80) of the accumulator. */
-	if (x == value) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (x >= value) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (res >= 0x80)  { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
+	// Carry is set when there is no borrow
+	set_carry_from_result(state, (uint16_t) x + (uint8_t) ~value + 1);
 	state->cpu->registers->PC++;
     }
 
-    break;
+    NEXT_ACTION;
 
     // SBC immediate, increment PC
-    case SBC_IMM_INC_PC:
+    ACTION(SBC_IMM_INC_PC):
     {
 	uint8_t acc = state->cpu->registers->ACC;
 	// The only difference between ADC and SBC should be that SBC "complements" (negates) it's argument
-	uint8_t value = ~read_mem(state, state->cpu->registers->PC);
+	uint8_t value = ~fetch_pc(state);
 	uint16_t res = ((uint16_t) acc) + ((uint16_t) value);
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
 	state->cpu->registers->ACC = (uint8_t) res;
 	state->cpu->registers->PC++;
     }
-    break;
+    NEXT_ACTION;
     // Pull Status register from stack and increment SP (In RTI)
-    case PULL_STATUS_REG_FROM_STACK_RTI:
+    ACTION(PULL_STATUS_REG_FROM_STACK_RTI):
     {
 	// Two instructions (PLP and RTI) pull a byte from the stack and set all the flags. They ignore bits 5 and 4.
-	uint8_t value = read_mem(state, state->cpu->registers->SP + 0x100);
+	uint8_t value = read_stack(state);
 	// Ignore bits 4 and 5
 	value &= 0xcf;
+	build_status_reg(state);
 	uint8_t cur_flags = state->cpu->registers->SR;
 	// Keep bits 4 and 5
 	cur_flags &= 0x30;
@@ -457,398 +799,393 @@ void execute_next_action(nes_state *state) {
 	state->cpu->registers->SR = cur_flags;
 	state->cpu->registers->SP++;
     }
-    break;
+    NEXT_ACTION;
     // ORA memory
-    case ORA_MEMORY:
+    ACTION(ORA_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte << 8) | ((uint16_t) state->cpu->low_addr_byte);
 	uint8_t res = state->cpu->registers->ACC | (read_mem(state, addr));
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
     }
-    break;
+    NEXT_ACTION;
     // AND memory
-    case AND_MEMORY:
+    ACTION(AND_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte << 8) | ((uint16_t) state->cpu->low_addr_byte);
 	uint8_t res = state->cpu->registers->ACC & (read_mem(state, addr));
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
     }
-    break;
+    NEXT_ACTION;
     // EOR memory
-    case EOR_MEMORY:
+    ACTION(EOR_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte << 8) | ((uint16_t) state->cpu->low_addr_byte);
 	uint8_t res = state->cpu->registers->ACC ^ (read_mem(state, addr));
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
     }
-    break;
+    NEXT_ACTION;
 
     // ADC memory
-    case ADC_MEMORY:
+    ACTION(ADC_MEMORY):
     {
 	uint8_t acc = state->cpu->registers->ACC;
 	uint8_t value = read_mem(state, ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte);
 	uint16_t res = ((uint16_t) acc) + ((uint16_t) value);
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
 	state->cpu->registers->ACC = (uint8_t) res;
     }
-    break;
+    NEXT_ACTION;
 
-    break;
+    NEXT_ACTION;
     // CMP memory
-    case CMP_MEMORY:
-    {
-	uint8_t reg = *state->cpu->source_reg;
-	uint8_t value = read_mem(state, ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte);
-	uint8_t res = reg - value;
-	/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
-	/* Compare sets flags as if a subtraction had been carried out. */
-	/* If the value in the accumulator is equal or greater than the compared value, */
-	/* the Carry will be set. */
-	/* The equal (Z) and negative (N) flags will be set based on equality or lack */
-	/* thereof and the sign (i.e. A>=$80) of the accumulator. */
-	if (reg == value) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (reg >= value) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (res >= 0x80)  { set_negative_flag(state); } else { clear_negative_flag(state); }
-    }
-
-    break;
+    ACTION(CMP_MEMORY):
+	COMPARE_MEMORY(REG(ACC));
+	NEXT_ACTION;
+    ACTION(CPX_MEMORY):
+	COMPARE_MEMORY(REG(X));
+	NEXT_ACTION;
+    ACTION(CPY_MEMORY):
+	COMPARE_MEMORY(REG(Y));
+	NEXT_ACTION;
 
     // SBC memory
-    case SBC_MEMORY:
+    ACTION(SBC_MEMORY):
     {
 	uint8_t acc = state->cpu->registers->ACC;
 	// The only difference between ADC and SBC should be that SBC "complements" (negates) it's argument
 	uint8_t value = ~read_mem(state, ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte);
 	uint16_t res = ((uint16_t) acc) + ((uint16_t) value);
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
 	state->cpu->registers->ACC = (uint8_t) res;
     }
-    break;
+    NEXT_ACTION;
 
     // clear carry flag
-    case CLEAR_CARRY_FLAG:
+    ACTION(CLEAR_CARRY_FLAG):
 	clear_carry_flag(state);
-	break;
+	NEXT_ACTION;
 	// clear zero flag
-    case CLEAR_ZERO_FLAG:
+    ACTION(CLEAR_ZERO_FLAG):
 	clear_zero_flag(state);
-	break;
+	NEXT_ACTION;
 	// clear interrupt flag
-    case CLEAR_INTERRUPT_FLAG:
+    ACTION(CLEAR_INTERRUPT_FLAG):
 	clear_interrupt_flag(state);
-	break;
+	NEXT_ACTION;
 	// clear decimal flag
-    case CLEAR_DECIMAL_FLAG:
+    ACTION(CLEAR_DECIMAL_FLAG):
 	clear_decimal_flag(state);
-	break;
+	NEXT_ACTION;
 	// clear break flag
-    case CLEAR_BREAK_FLAG:
+    ACTION(CLEAR_BREAK_FLAG):
 	clear_break_flag(state);
-	break;
+	NEXT_ACTION;
 	// clear overflow flag
-    case CLEAR_OVERFLOW_FLAG:
+    ACTION(CLEAR_OVERFLOW_FLAG):
 	clear_overflow_flag(state);
-	break;
+	NEXT_ACTION;
 	// clear negative flag
-    case CLEAR_NEGATIVE_FLAG:
+    ACTION(CLEAR_NEGATIVE_FLAG):
 	clear_negative_flag(state);
-	break;
+	NEXT_ACTION;
 	// set carry flag
-    case SET_CARRY_FLAG:
+    ACTION(SET_CARRY_FLAG):
 	set_carry_flag(state);
-	break;
+	NEXT_ACTION;
 	// set zero flag
-    case SET_ZERO_FLAG:
+    ACTION(SET_ZERO_FLAG):
 	set_zero_flag(state);
-	break;
+	NEXT_ACTION;
 	// set interrupt flag
-    case SET_INTERRUPT_FLAG:
+    ACTION(SET_INTERRUPT_FLAG):
 	set_interrupt_flag(state);
-	break;
+	NEXT_ACTION;
 	// set decimal flag
-    case SET_DECIMAL_FLAG:
+    ACTION(SET_DECIMAL_FLAG):
 	set_decimal_flag(state);
-	break;
+	NEXT_ACTION;
 	// set break flag
-    case SET_BREAK_FLAG:
+    ACTION(SET_BREAK_FLAG):
 	set_break_flag(state);
-	break;
+	NEXT_ACTION;
 	// set overflow flag
-    case SET_OVERFLOW_FLAG:
+    ACTION(SET_OVERFLOW_FLAG):
 	set_overflow_flag(state);
-	break;
+	NEXT_ACTION;
 	// set negative flag
-    case SET_NEGATIVE_FLAG:
+    ACTION(SET_NEGATIVE_FLAG):
 	set_negative_flag(state);
-	break;
-
-	// Increment source register
-    case INC_SOURCE_REG:
-	(*state->cpu->source_reg)++;
-	if (*state->cpu->source_reg == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (*state->cpu->source_reg & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	break;
-	// Decrement source register
-    case DEC_SOURCE_REG:
-	(*state->cpu->source_reg)--;
-	if (*state->cpu->source_reg == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (*state->cpu->source_reg & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	break;
-	// Copy source_reg to destination_reg, affect N,Z flags
-    case COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS:
-	(*state->cpu->destination_reg) = (*state->cpu->source_reg);
-	if (*state->cpu->destination_reg == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (*state->cpu->destination_reg & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	break;
-	// Copy source_reg to destination_reg, affect no flags
-    case COPY_SOURCE_REG_TO_DEST_REG_NO_FLAGS:
-	(*state->cpu->destination_reg) = (*state->cpu->source_reg);
-	break;
+	NEXT_ACTION;
+
+	// Increment X or Y
+    ACTION(INC_X):
+	INCREMENT(REG(X));
+	NEXT_ACTION;
+    ACTION(INC_Y):
+	INCREMENT(REG(Y));
+	NEXT_ACTION;
+	// Decrement X or Y
+    ACTION(DEC_X):
+	DECREMENT(REG(X));
+	NEXT_ACTION;
+    ACTION(DEC_Y):
+	DECREMENT(REG(Y));
+	NEXT_ACTION;
+	// Transfer between registers, affect N,Z flags
+    ACTION(COPY_ACC_TO_X_AFFECT_NZ_FLAGS):
+	COPY_AFFECT_NZ_FLAGS(REG(ACC), REG(X));
+	NEXT_ACTION;
+    ACTION(COPY_ACC_TO_Y_AFFECT_NZ_FLAGS):
+	COPY_AFFECT_NZ_FLAGS(REG(ACC), REG(Y));
+	NEXT_ACTION;
+    ACTION(COPY_SP_TO_X_AFFECT_NZ_FLAGS):
+	COPY_AFFECT_NZ_FLAGS(REG(SP), REG(X));
+	NEXT_ACTION;
+    ACTION(COPY_X_TO_ACC_AFFECT_NZ_FLAGS):
+	COPY_AFFECT_NZ_FLAGS(REG(X), REG(ACC));
+	NEXT_ACTION;
+    ACTION(COPY_Y_TO_ACC_AFFECT_NZ_FLAGS):
+	COPY_AFFECT_NZ_FLAGS(REG(Y), REG(ACC));
+	NEXT_ACTION;
+	// TXS, affects no flags
+    ACTION(COPY_X_TO_SP_NO_FLAGS):
+	state->cpu->registers->SP = state->cpu->registers->X;
+	NEXT_ACTION;
 
 
 	// Fetch high byte of address, increment PC
-    case FETCH_HIGH_ADDR_BYTE_INC_PC:
-	state->cpu->high_addr_byte = read_mem(state, state->cpu->registers->PC);
+    ACTION(FETCH_HIGH_ADDR_BYTE_INC_PC):
+	state->cpu->high_addr_byte = fetch_pc(state);
 	state->cpu->registers->PC++;
-	break;
+	NEXT_ACTION;
 
 	// Write register to effective address - non-zero page
-    case WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE:
-    {
-	uint16_t addr = state->cpu->high_addr_byte << 8 | state->cpu->low_addr_byte;
-	write_mem(state, addr, *state->cpu->source_reg);
-	/* state->memory[addr] = (*state->cpu->source_reg); */
-    }
-    break;
+    ACTION(WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE):
+	WRITE_TO_EFF_ADDR_NON_ZEROPAGE(REG(ACC));
+	NEXT_ACTION;
+    ACTION(WRITE_X_TO_EFF_ADDR_NON_ZEROPAGE):
+	WRITE_TO_EFF_ADDR_NON_ZEROPAGE(REG(X));
+	NEXT_ACTION;
+    ACTION(WRITE_Y_TO_EFF_ADDR_NON_ZEROPAGE):
+	WRITE_TO_EFF_ADDR_NON_ZEROPAGE(REG(Y));
+	NEXT_ACTION;
 
     // Read from effective address, store in register, affect N,Z flags
-    case READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS:
-    {
-	uint16_t addr = state->cpu->high_addr_byte << 8 | state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
-	(*state->cpu->destination_reg) = value;
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
-    }
-    break;
+    ACTION(READ_EFF_ADDR_STORE_IN_ACC_AFFECT_NZ_FLAGS):
+	READ_EFF_ADDR_STORE_IN(REG(ACC));
+	NEXT_ACTION;
+    ACTION(READ_EFF_ADDR_STORE_IN_X_AFFECT_NZ_FLAGS):
+	READ_EFF_ADDR_STORE_IN(REG(X));
+	NEXT_ACTION;
+    ACTION(READ_EFF_ADDR_STORE_IN_Y_AFFECT_NZ_FLAGS):
+	READ_EFF_ADDR_STORE_IN(REG(Y));
+	NEXT_ACTION;
+    // LDA/LDX/LDY zero page (and zero page indexed, where ZEROPAGE_ADD already wrapped the address)
+    ACTION(READ_ZEROPAGE_STORE_IN_ACC_AFFECT_NZ_FLAGS):
+	READ_ZEROPAGE_STORE_IN(REG(ACC));
+	NEXT_ACTION;
+    ACTION(READ_ZEROPAGE_STORE_IN_X_AFFECT_NZ_FLAGS):
+	READ_ZEROPAGE_STORE_IN(REG(X));
+	NEXT_ACTION;
+    ACTION(READ_ZEROPAGE_STORE_IN_Y_AFFECT_NZ_FLAGS):
+	READ_ZEROPAGE_STORE_IN(REG(Y));
+	NEXT_ACTION;
 
     // Used in illegal LAX instruction
-    case LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS:
+    ACTION(LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS):
     {
 	uint16_t addr = state->cpu->high_addr_byte << 8 | state->cpu->low_addr_byte;
 
 	uint8_t value = read_mem(state, addr);
 	state->cpu->registers->ACC = value;
 	state->cpu->registers->X = value;
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, value);
     }
-    break;
+    NEXT_ACTION;
 
     // Read from address, add X-register to result, store in "operand"
-    case READ_ADDR_ADD_INDEX_STORE_IN_OPERAND:
+    ACTION(READ_ADDR_ADD_X_STORE_IN_OPERAND):
 	state->cpu->operand = read_mem(state, state->cpu->registers->PC - 1);
-	state->cpu->operand += *state->cpu->index_reg;
-	break;
+	state->cpu->operand += state->cpu->registers->X;
+	NEXT_ACTION;
 
 	// Fetch effective address low
-    case FETCH_EFF_ADDR_LOW:
-	state->cpu->low_addr_byte = read_mem(state, (uint16_t) state->cpu->operand);
-	break;
+    ACTION(FETCH_EFF_ADDR_LOW):
+	state->cpu->low_addr_byte = read_zp(state, state->cpu->operand);
+	NEXT_ACTION;
 
 	// Fetch effective address high
-    case FETCH_EFF_ADDR_HIGH:
+    ACTION(FETCH_EFF_ADDR_HIGH):
       {
-        state->cpu->high_addr_byte = read_mem(state, (uint16_t) ((uint16_t) state->cpu->operand+1) & 0xff);
+        state->cpu->high_addr_byte = read_zp(state, state->cpu->operand + 1);
       }
-      break;
+      NEXT_ACTION;
 
       // Fetch effective address high, add index to full addr
-    case FETCH_EFF_ADDR_HIGH_ADD_INDEX:
+    ACTION(FETCH_EFF_ADDR_HIGH_ADD_Y):
       {
-        uint16_t addr = read_mem(state, (uint16_t) ((uint16_t) state->cpu->operand+1) & 0xff);
+        uint16_t addr = read_zp(state, state->cpu->operand + 1);
         addr = addr << 8;
         addr |= state->cpu->low_addr_byte;
         // Figure out if page boundary was crossed, add stall cycle if needed
-        if (((addr >> 8) != ((addr + *state->cpu->index_reg) >> 8))) {
-          add_action_to_queue(state, STALL_CYCLE);
+        if (((addr >> 8) != ((addr + state->cpu->registers->Y) >> 8))) {
+          add_stall_cycle(state);
         }
 
-        addr += *state->cpu->index_reg;
+        addr += state->cpu->registers->Y;
         state->cpu->low_addr_byte = addr & 0xFF;
         state->cpu->high_addr_byte = addr >> 8;
       }
-      break;
+      NEXT_ACTION;
       // Fetch zeropage pointer address, store pointer in "operand", increment PC
-    case FETCH_ZP_PTR_ADDR_INC_PC:
+    ACTION(FETCH_ZP_PTR_ADDR_INC_PC):
       {
-        state->cpu->operand = read_mem(state, state->cpu->registers->PC);
+        state->cpu->operand = fetch_pc(state);
         state->cpu->registers->PC++;
       }
-    break;
+    NEXT_ACTION;
+
+    // The cycle before the write of every read-modify-write: read the value at the effective
+    // address into "operand" and write it back unchanged, like the 6502 does. Boards see both
+    // writes, MMC1 is reset by the first one of an INC of a byte with bit 7 set (see mmc1_write).
+    // The action writing the result modifies "operand".
+    ACTION(READ_EFF_ADDR_DUMMY_WRITE):
+    {
+	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte;
+	state->cpu->operand = read_mem(state, addr);
+	write_mem(state, addr, state->cpu->operand);
+    }
+    NEXT_ACTION;
 
     // Increment memory
-    case INC_MEMORY:
+    ACTION(INC_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte;
-	(state->memory[addr])++;
-	if ((state->memory[addr]) == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((state->memory[addr]) & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	uint8_t value = state->cpu->operand + 1;
+	set_nz_from_result(state, value);
+	write_mem(state, addr, value);
     }
-    break;
+    NEXT_ACTION;
 
     // Decrement memory
-    case DEC_MEMORY:
+    ACTION(DEC_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t) state->cpu->low_addr_byte;
-	(state->memory[addr])--;
-	if ((state->memory[addr]) == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((state->memory[addr]) & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	uint8_t value = state->cpu->operand - 1;
+	set_nz_from_result(state, value);
+	write_mem(state, addr, value);
     }
-    break;
+    NEXT_ACTION;
 
     // Fetch effective address high from PC+1, add index to low byte of effective address, inc pc
-    case FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC:
-	state->cpu->high_addr_byte = read_mem(state, (uint16_t) ((uint16_t) state->cpu->registers->PC));
-	// Fix high address, one cycle early
-	// Add a stall cycle if page boundary is crossed
-	if (((uint16_t)state->cpu->low_addr_byte + (uint16_t)*state->cpu->index_reg) > 0xFF) {
-	    state->cpu->high_addr_byte++;
-	    add_action_to_queue(state, STALL_CYCLE);
-	}
-	state->cpu->low_addr_byte += *state->cpu->index_reg;
-	state->cpu->registers->PC++;
-	break;
+    ACTION(FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC):
+	FETCH_EFF_ADDR_HIGH_ADD_INC_PC(REG(X));
+	NEXT_ACTION;
+    ACTION(FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC):
+	FETCH_EFF_ADDR_HIGH_ADD_INC_PC(REG(Y));
+	NEXT_ACTION;
 
 	// Fetch effective address high from PC+1, add index to low byte of effective address, inc pc
-    case FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES:
-	state->cpu->high_addr_byte = read_mem(state, (uint16_t) ((uint16_t) state->cpu->registers->PC));
-	// Fix high address, one cycle early
-	if (((uint16_t)state->cpu->low_addr_byte + (uint16_t)*state->cpu->index_reg) > 0xFF) {
-	    state->cpu->high_addr_byte++;
-	    /* add_action_to_queue(state, STALL_CYCLE); */
-	}
-	state->cpu->low_addr_byte += *state->cpu->index_reg;
-	state->cpu->registers->PC++;
-	break;
+    ACTION(FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES):
+	FETCH_EFF_ADDR_HIGH_ADD_INC_PC_NO_EXTRA_CYCLES(REG(X));
+	NEXT_ACTION;
+    ACTION(FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES):
+	FETCH_EFF_ADDR_HIGH_ADD_INC_PC_NO_EXTRA_CYCLES(REG(Y));
+	NEXT_ACTION;
 
 
 
-	// read from effective address, "fix high byte" (write to destination_reg)
-    case READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
-    {
-
-	uint16_t eff_addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
-	uint8_t value = read_mem(state, eff_addr);
-	*state->cpu->destination_reg = value;
-	// Set flags for LDA
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
-    }
-    break;
+	// LDA/LDY read from effective address, "fix high byte"
+    ACTION(READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_ACC):
+	READ_EFF_ADDR_STORE_IN(REG(ACC));
+	NEXT_ACTION;
+    ACTION(READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_Y):
+	READ_EFF_ADDR_STORE_IN(REG(Y));
+	NEXT_ACTION;
 
     // Fetch high byte of address from operand+1, add index to low_addr
-    case FETCH_HIGH_BYTE_ADDR_ADD_INDEX:
+    ACTION(FETCH_HIGH_BYTE_ADDR_ADD_Y):
     {
-	state->cpu->high_addr_byte = read_mem(state, state->cpu->operand+1);
+	state->cpu->high_addr_byte = read_zp(state, state->cpu->operand + 1);
 	// Add a stall cycle if page boundary crossed
 	/* This penalty applies to calculated 16bit addresses that are of the type base16 + offset, where the final memory location (base16 + offset) is in a different page than base. base16 can either be the direct or indirect version, but it'll be 16bits either way (and offset will be the contents of either x or y) */
 	uint16_t base = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
-	uint16_t offset = *state->cpu->index_reg;
+	uint16_t offset = state->cpu->registers->Y;
 	if (((base & 0xFF) + offset) > 0xFF) {
-	    add_action_to_queue(state, STALL_CYCLE); // add a stall cycle
-	    // fix high_addr (one cycle early, but hell)
-	    if (state->cpu->high_addr_byte < 0xFF) {
-		state->cpu->high_addr_byte += 1;
-	    }
+	    add_stall_cycle(state); // add a stall cycle
 	}
+	// The carry into the high byte comes with the addition below
 	uint16_t eff_addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 	eff_addr += offset;
 	state->cpu->high_addr_byte = eff_addr >> 8;
 	state->cpu->low_addr_byte = eff_addr & 0xFF;
     }
-    break;
+    NEXT_ACTION;
 
-    // ORA read from effective address, "fix high byte" (write to destination_reg)
-    case ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // ORA read from effective address, "fix high byte" (write to ACC)
+    ACTION(ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 
-	uint8_t value = (*state->cpu->destination_reg) | read_mem(state, addr);
-	*state->cpu->destination_reg = value;
+	uint8_t value = state->cpu->registers->ACC | read_mem(state, addr);
+	state->cpu->registers->ACC = value;
 	// Set flags for ORA
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, value);
     }
-    break;
+    NEXT_ACTION;
 
-    // AND read from effective address, "fix high byte" (write to destination_reg)
-    case AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // AND read from effective address, "fix high byte" (write to ACC)
+    ACTION(AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
-	uint8_t value = (*state->cpu->destination_reg) & read_mem(state, addr);
-	*state->cpu->destination_reg = value;
+	uint8_t value = state->cpu->registers->ACC & read_mem(state, addr);
+	state->cpu->registers->ACC = value;
 	// Set flags for AND
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, value);
     }
-    break;
+    NEXT_ACTION;
 
-    // EOR read from effective address, "fix high byte" (write to destination_reg)
-    case EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // EOR read from effective address, "fix high byte" (write to ACC)
+    ACTION(EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 
-	uint8_t value = (*state->cpu->destination_reg) ^ read_mem(state, addr);
-	*state->cpu->destination_reg = value;
+	uint8_t value = state->cpu->registers->ACC ^ read_mem(state, addr);
+	state->cpu->registers->ACC = value;
 	// Set flags for EOR
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, value);
     }
-    break;
+    NEXT_ACTION;
 
-    // ADC read from effective address, "fix high byte" (write to destination_reg)
-    case ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // ADC read from effective address, "fix high byte" (write to ACC)
+    ACTION(ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
-	uint8_t acc = *state->cpu->destination_reg;
+	uint8_t acc = state->cpu->registers->ACC;
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 	uint8_t value = read_mem(state, addr);
 	uint16_t res = ((uint16_t) acc) + ((uint16_t) value);
 	// Set flags for ADC
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
-	*state->cpu->destination_reg = (uint8_t) res;
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
+	state->cpu->registers->ACC = (uint8_t) res;
     }
-    break;
+    NEXT_ACTION;
 
-    // CMP read from effective address, "fix high byte" (write to destination_reg)
-    case CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // CMP read from effective address, "fix high byte" (write to ACC)
+    ACTION(CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
-	uint8_t reg = *state->cpu->destination_reg;
+	uint8_t reg = state->cpu->registers->ACC;
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 	uint8_t value = read_mem(state, addr);
 	uint8_t res = reg - value;
@@ -858,62 +1195,59 @@ void execute_next_action(nes_state *state) {
 	/* the Carry will be set. */
 	/* The equal (Z) and negative (N) flags will be set based on equality or lack */
 	/* thereof and the sign (i.e. A>=$80) of the accumulator. */
-	if (reg == value) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (reg >= value) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (res >= 0x80)  { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
+	// Carry is set when there is no borrow
+	set_carry_from_result(state, (uint16_t) reg + (uint8_t) ~value + 1);
     }
-    break;
+    NEXT_ACTION;
 
-    // SBC read from effective address, "fix high byte" (write to destination_reg)
-    case SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // SBC read from effective address, "fix high byte" (write to ACC)
+    ACTION(SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
-	uint8_t reg = *state->cpu->destination_reg;
+	uint8_t reg = state->cpu->registers->ACC;
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 	uint8_t value = ~(read_mem(state, addr));
 	uint16_t res = ((uint16_t) reg) + ((uint16_t) value);
 	// Set flags for SBC
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((reg ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
-	*state->cpu->destination_reg = (uint8_t) res;
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (reg ^ (uint8_t) res) & (value ^ (uint8_t) res));
+	state->cpu->registers->ACC = (uint8_t) res;
     }
-    break;
+    NEXT_ACTION;
 
-    // STA read from effective address, "fix high byte" (write to destination_reg)
-    case STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // STA read from effective address, "fix high byte" (write to ACC)
+    ACTION(STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
 	// High byte has (hopefully) been fixed earlier, so this is basically a stall cycle
 	/* uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8); */
 
 	/* state->memory[addr] = *state->cpu->destination_reg; */
     }
-    break;
+    NEXT_ACTION;
 
 
-    // STA/STX/STY read from effective address, "fix high byte" (write to destination_reg)
-    case STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE:
+    // STA/STX/STY read from effective address, "fix high byte" (write to ACC)
+    ACTION(STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE):
     {
 
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 
-	state->memory[addr] = *state->cpu->source_reg;
+	write_mem(state, addr, state->cpu->registers->ACC);
     }
-    break;
+    NEXT_ACTION;
 
     // R  fetch low address to "latch"
-    case FETCH_LOW_ADDR_TO_LATCH:
+    ACTION(FETCH_LOW_ADDR_TO_LATCH):
 	// use "operand" as latch
     {
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
 	state->cpu->operand = read_mem(state,addr);
     }
-    break;
+    NEXT_ACTION;
     // R  fetch PCH, copy "latch" to PCL
-    case FETCH_PCH_COPY_LATCH_TO_PCL:
+    ACTION(FETCH_PCH_COPY_LATCH_TO_PCL):
 	// use "operand" as latch
     {
 	uint16_t addr = ((uint16_t) state->cpu->low_addr_byte) | (((uint16_t) state->cpu->high_addr_byte) << 8);
@@ -928,147 +1262,125 @@ void execute_next_action(nes_state *state) {
 	uint16_t pch = (uint16_t) read_mem(state,addr);
 	state->cpu->registers->PC = ((uint16_t) state->cpu->operand) | (pch << 8);
     }
-    break;
+    NEXT_ACTION;
 
     // LSR (reg and zero-page Memory)
-    case LSR_SOURCE_REG:
-	if (*state->cpu->source_reg & 0x1) { set_carry_flag(state); }
-	else { clear_carry_flag(state); }
-	*state->cpu->source_reg = *state->cpu->source_reg >> 1;
-	clear_negative_flag(state);
-	if (*state->cpu->source_reg != 0) { clear_zero_flag(state); } else { set_zero_flag(state); }
-	break;
+    ACTION(LSR_ACC):
+	LSR_REG(REG(ACC));
+	NEXT_ACTION;
+    ACTION(LSR_ZEROPAGE):
+	LSR_REG(ZEROPAGE_MEMORY);
+	NEXT_ACTION;
 
 	// ASL (reg and zero-page Memory)
-    case ASL_SOURCE_REG:
-	if (*state->cpu->source_reg & 0x80) { set_carry_flag(state); }
-	else { clear_carry_flag(state); }
-	*state->cpu->source_reg = *state->cpu->source_reg << 1;
-	if (*state->cpu->source_reg & 0x80) { set_negative_flag(state); } else {
-	    clear_negative_flag(state);
-	}
-	if (*state->cpu->source_reg != 0) { clear_zero_flag(state); } else { set_zero_flag(state); }
-	break;
-
-	// ROR source-reg
-    case ROR_SOURCE_REG:
-    {
-	uint8_t newval = *state->cpu->source_reg;
-	bool carry = is_carry_flag_set(state);
-	uint8_t lsb = newval & 1;
-	newval = newval >> 1;
-	if (carry) { newval |= 0x80; set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (lsb) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (newval == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	*state->cpu->source_reg = newval;
-    }
-    break;
-
-    // ROL source_reg
-    case ROL_SOURCE_REG:
-    {
-	uint8_t newval = *state->cpu->source_reg;
-	bool carry = is_carry_flag_set(state);
-	uint8_t msb = newval & 0x80;
-	newval = newval << 1;
-	if (carry) { newval |= 0x1; }
-	if (newval & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (msb) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (newval == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	*state->cpu->source_reg = newval;
-    }
-    break;
+    ACTION(ASL_ACC):
+	ASL_REG(REG(ACC));
+	NEXT_ACTION;
+    ACTION(ASL_ZEROPAGE):
+	ASL_REG(ZEROPAGE_MEMORY);
+	NEXT_ACTION;
+
+	// ROR (reg and zero-page Memory)
+    ACTION(ROR_ACC):
+	ROR_REG(REG(ACC));
+	NEXT_ACTION;
+    ACTION(ROR_ZEROPAGE):
+	ROR_REG(ZEROPAGE_MEMORY);
+	NEXT_ACTION;
+
+    // ROL (reg and zero-page Memory)
+    ACTION(ROL_ACC):
+	ROL_REG(REG(ACC));
+	NEXT_ACTION;
+    ACTION(ROL_ZEROPAGE):
+	ROL_REG(ZEROPAGE_MEMORY);
+	NEXT_ACTION;
 
     // LSR (memory)
-    case LSR_MEMORY:
+    ACTION(LSR_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
-	if (value & 0x1) { set_carry_flag(state); }
-	else { clear_carry_flag(state); }
+	uint8_t value = state->cpu->operand;
+	set_carry_from_result(state, (uint16_t) value << 8);
 	value = value >> 1;
-	clear_negative_flag(state);
-	if (value != 0) { clear_zero_flag(state); } else { set_zero_flag(state); }
+	set_nz_from_result(state, value);
 	write_mem(state, addr, value);
 	/* state->memory[addr] = value; */
     }
-    break;
+    NEXT_ACTION;
 
     // ASL memory
-    case ASL_MEMORY:
+    ACTION(ASL_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
-	if (value & 0x80) { set_carry_flag(state); }
-	else { clear_carry_flag(state); }
+	uint8_t value = state->cpu->operand;
+	set_carry_from_result(state, (uint16_t) value << 1);
 	value = value << 1;
-	if (value & 0x80) { set_negative_flag(state); } else {
-	    clear_negative_flag(state);
-	}
-	if (value != 0) { clear_zero_flag(state); } else { set_zero_flag(state); }
+	set_nz_from_result(state, value);
 	write_mem(state, addr, value);
 	/* state->memory[addr] = value; */
     }
-    break;
+    NEXT_ACTION;
 
     // ROR Memory
-    case ROR_MEMORY:
+    ACTION(ROR_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
+	uint8_t value = state->cpu->operand;
 	bool carry = is_carry_flag_set(state);
 	uint8_t lsb = value & 1;
 	value = value >> 1;
-	if (carry) { value |= 0x80; set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (lsb) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
+	if (carry) { value |= 0x80; }
+	set_carry_from_result(state, (uint16_t) lsb << 8);
+	set_nz_from_result(state, value);
 	write_mem(state, addr, value);
     }
-    break;
+    NEXT_ACTION;
 
     // ROL Memory
-    case ROL_MEMORY:
+    ACTION(ROL_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
+	uint8_t value = state->cpu->operand;
 	bool carry = is_carry_flag_set(state);
 	uint8_t msb = value & 0x80;
 	value = value << 1;
 	if (carry) { value |= 0x1; }
-	if (value & 0x80 ) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (msb) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
+	set_carry_from_result(state, (uint16_t) msb << 1);
+	set_nz_from_result(state, value);
 	write_mem(state, addr, value);
     }
-    break;
+    NEXT_ACTION;
 
-    case ZEROPAGE_ADD_INDEX:
-	state->cpu->low_addr_byte += *state->cpu->index_reg;
-	state->cpu->high_addr_byte = 0;
-	break;
+    ACTION(ZEROPAGE_ADD_X):
+	ZEROPAGE_ADD(REG(X));
+	NEXT_ACTION;
+    ACTION(ZEROPAGE_ADD_Y):
+	ZEROPAGE_ADD(REG(Y));
+	NEXT_ACTION;
 
-    case FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE:
+    ACTION(FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE):
     {
-	state->cpu->high_addr_byte = read_mem(state, state->cpu->operand+1);
-	state->cpu->low_addr_byte += *state->cpu->index_reg;
+	state->cpu->high_addr_byte = read_zp(state, state->cpu->operand + 1);
+	state->cpu->low_addr_byte += state->cpu->registers->Y;
     }
-	break;
+	NEXT_ACTION;
 
-    case SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS:
+    ACTION(SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
 	uint8_t value = state->cpu->registers->ACC & state->cpu->registers->X;
 	write_mem(state, addr, value);
     }
-    break;
+    NEXT_ACTION;
 
-    case DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY:
+    ACTION(DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
 	// Do the DEC MEM
-	(state->memory[addr])--;
+	uint8_t value = state->cpu->operand - 1;
+	write_mem(state, addr, value);
 	// Do the CMP
-	uint8_t value = read_mem(state, addr);
 	uint8_t reg = state->cpu->registers->ACC;
 	uint8_t res = reg - value;
 	/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
@@ -1077,118 +1389,109 @@ void execute_next_action(nes_state *state) {
 	/* the Carry will be set. */
 	/* The equal (Z) and negative (N) flags will be set based on equality or lack */
 	/* thereof and the sign (i.e. A>=$80) of the accumulator. */
-	if (reg == value) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (reg >= value) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (res >= 0x80)  { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
+	// Carry is set when there is no borrow
+	set_carry_from_result(state, (uint16_t) reg + (uint8_t) ~value + 1);
     }
-    break;
+    NEXT_ACTION;
 
-    case ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY:
+    ACTION(ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
 	// Do the INC MEM
-	(state->memory[addr])++;
+	uint8_t result = state->cpu->operand + 1;
+	write_mem(state, addr, result);
 	// Do the SBC
 	uint8_t acc = state->cpu->registers->ACC;
 	// The only difference between ADC and SBC should be that SBC "complements" (negates) it's argument
-	uint8_t value = ~read_mem(state, addr);
+	uint8_t value = ~result;
 	uint16_t res = ((uint16_t) acc) + ((uint16_t) value);
 	if (is_carry_flag_set(state)) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
 	state->cpu->registers->ACC = (uint8_t) res;
     }
-    break;
+    NEXT_ACTION;
 
 
 
-    case FIX_HIGH_BYTE_NO_WRITE:
+    ACTION(FIX_HIGH_BYTE_NO_WRITE):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t offset = *state->cpu->index_reg;
+	uint8_t offset = state->cpu->registers->Y;
 	if ((addr - offset) >> 8 != addr >> 8) {
 	    state->cpu->high_addr_byte++;
 	}
 
     }
-    break;
+    NEXT_ACTION;
 
-    case SLO_DO_ASL_THEN_ORA:
+    ACTION(SLO_DO_ASL_THEN_ORA):
     {
 	// Shift left one bit in memory, then OR ACC with MEM
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
+	uint8_t value = state->cpu->operand;
 	// Affect carry flag before shifting away the byte
-	if (value & 0x80) { set_carry_flag(state); }  else { clear_carry_flag(state); }
+	set_carry_from_result(state, (uint16_t) value << 1);
 	value = value << 1;
 	write_mem(state, addr, value);
-	uint8_t res = state->cpu->registers->ACC | (read_mem(state, addr));
+	uint8_t res = state->cpu->registers->ACC | value;
 	// Set ORA flags
-	if (res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (res > 0x7F) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, res);
 	state->cpu->registers->ACC = res;
 
     }
-	break;
+	NEXT_ACTION;
 
-    case RLA_DO_ROL_THEN_AND:
+    ACTION(RLA_DO_ROL_THEN_AND):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
 	// ROL
-	uint8_t value = read_mem(state, addr);
+	uint8_t value = state->cpu->operand;
 	bool carry = is_carry_flag_set(state);
 	uint8_t msb = value & 0x80;
 	value = value << 1;
 	if (carry) { value |= 0x1; }
-	if (value & 0x80 ) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (msb) { set_carry_flag(state); } else { clear_carry_flag(state); }
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
+	set_carry_from_result(state, (uint16_t) msb << 1);
+	set_nz_from_result(state, value);
 	write_mem(state, addr, value);
 	// AND ACC
 	value = (state->cpu->registers->ACC) & value;
 	state->cpu->registers->ACC = value;
 	// Set flags for AND
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, value);
     }
-	break;
+	NEXT_ACTION;
 
-    case SRE_DO_LSR_THEN_EOR_ACC:
+    ACTION(SRE_DO_LSR_THEN_EOR_ACC):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
-	uint8_t value = read_mem(state, addr);
+	uint8_t value = state->cpu->operand;
 	// LSR
-	if (value & 0x1) { set_carry_flag(state); }
-	else { clear_carry_flag(state); }
+	set_carry_from_result(state, (uint16_t) value << 8);
 	value = value >> 1;
 	write_mem(state, addr, value);
 	// EOR
 	value = state->cpu->registers->ACC ^ value;
 	state->cpu->registers->ACC = value;
 	// Set flags for EOR
-	if (value == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if (value & 0x80) { set_negative_flag(state); } else { clear_negative_flag(state); }
+	set_nz_from_result(state, value);
 
     }
-    break;
+    NEXT_ACTION;
 
-    case RRA_DO_ROR_THEN_ADC:
+    ACTION(RRA_DO_ROR_THEN_ADC):
     {
 	uint16_t addr = ((uint16_t) state->cpu->high_addr_byte) << 8 | (uint16_t)state->cpu->low_addr_byte;
 	// ROR Memory
-	uint8_t value = read_mem(state, addr);
+	uint8_t value = state->cpu->operand;
 	uint8_t lsb = value & 1;
 	value = value >> 1;
 	if (is_carry_flag_set(state)) {
 	    value |= 0x80;
 	}
-	if (lsb) {
-	    set_carry_flag(state);
-	} else { clear_carry_flag(state); }
+	set_carry_from_result(state, (uint16_t) lsb << 8);
 	write_mem(state, addr, value);
 
 	// ADC
@@ -1197,3235 +1500,158 @@ void execute_next_action(nes_state *state) {
 	// Set flags for ADC
 	// Is carry flag set
 	if (lsb) { res++; }
-	if ((uint8_t) res == 0) { set_zero_flag(state); } else { clear_zero_flag(state); }
-	if ((res & 128) == 128) { set_negative_flag(state); } else { clear_negative_flag(state); }
-	if (res > 255) { set_carry_flag(state);} else { clear_carry_flag(state); }
-	if ((acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80)
-        {    set_overflow_flag(state); }
-	else { clear_overflow_flag(state);}
+	set_nz_from_result(state, (uint8_t) res);
+	set_carry_from_result(state, res);
+	set_overflow_from_result(state, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res));
 	state->cpu->registers->ACC = (uint8_t) res;
 
     }
-    break;
+    NEXT_ACTION;
 
 // Interrupts
-// I think(!) that I need to fetch a pointer from these locations instead of just jumping there.
-    case NMI_FETCH_PCL:
-	/* state->cpu->registers->PC = 0xFFFA; */
-	break;
-    case NMI_FETCH_PCH:
-	state->cpu->registers->PC = read_mem(state, 0xFFFA);
-	state->cpu->registers->PC |= read_mem(state, 0xFFFB) << 8;
-
-	break;
-    case IRQ_FETCH_PCL:
-	state->cpu->registers->PC = 0xFFFE;
-	break;
-    case IRQ_FETCH_PCH:
-	// Do nothing
-	break;
-    case BRK_FETCH_PCL:
+// NMI and IRQ, the vector was picked when the interrupt was taken (see start_instruction)
+    ACTION(INTERRUPT_FETCH_PCL):
+	set_interrupt_flag(state);
+	NEXT_ACTION;
+    ACTION(INTERRUPT_FETCH_PCH):
+	state->cpu->registers->PC = read_mem(state, state->cpu->interrupt_vector);
+	state->cpu->registers->PC |= read_mem(state, state->cpu->interrupt_vector + 1) << 8;
+
+	NEXT_ACTION;
+    ACTION(BRK_FETCH_PCL):
 	/* state->cpu->registers->PC = 0xFFFE; */
-	break;
-    case BRK_FETCH_PCH:
+	NEXT_ACTION;
+    ACTION(BRK_FETCH_PCH):
 	state->cpu->registers->PC = read_mem(state, 0xFFFE);
 	state->cpu->registers->PC |= read_mem(state, 0xFFFF) << 8;
 
-	break;
-    case PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG:
+	NEXT_ACTION;
+    ACTION(PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG):
 	/* See this note about the B flag for explanation of the OR */
 	/* https://wiki.nesdev.com/w/index.php/Status_flags#The_B_flag */
-	set_interrupt_flag(state);
-	state->memory[state->cpu->registers->SP + 0x100] = 32 | state->cpu->registers->SR;
+	build_status_reg(state);
+	write_stack(state, 32 | state->cpu->registers->SR);
 	state->cpu->registers->SP--;
 
-	break;
+	NEXT_ACTION;
 
-    case PUSH_STATUS_REG_DEC_S_SET_B_FLAG:
+    ACTION(PUSH_STATUS_REG_DEC_S_SET_B_FLAG):
 	/* See this note about the B flag for explanation of the OR */
 	/* https://wiki.nesdev.com/w/index.php/Status_flags#The_B_flag */
 
-	state->memory[state->cpu->registers->SP + 0x100] = 48 | state->cpu->registers->SR;
+	build_status_reg(state);
+	write_stack(state, 48 | state->cpu->registers->SR);
 	state->cpu->registers->SP--;
 
-	break;
+	NEXT_ACTION;
 
 
 
     }
-
-    state->cpu->next_action++;
-    if (state->cpu->next_action > 9) { state->cpu->next_action = 0; }
+    // Only reached with the switch, the threaded handlers go on to the next action themselves
+    if (more == 0) {
+	return;
+    }
+    more--;
+    action = next_program_action(state);
+    goto dispatch;
 }
 
-void add_action_to_queue(nes_state *state, uint16_t action) {
-    state->cpu->action_queue[state->cpu->end_of_queue] = action;
-    state->cpu->end_of_queue++;
-    if (state->cpu->end_of_queue > 9) {   state->cpu->end_of_queue = 0; }
+void execute_next_action(nes_state *state) {
+    uint8_t action = STALL_CYCLE;
+    if (state->cpu->next_action < state->cpu->program_length) {
+	action = state->cpu->program[state->cpu->next_action];
+	state->cpu->next_action++;
+    }
+    else {
+	// Extra cycles (page crossings, taken branches, OAM DMA) run after the program
+	if (state->cpu->oam_dma_align) { align_oam_dma(state); }
+	state->cpu->stall_cycles--;
+    }
+    run_actions(state, action, 0);
 }
 
+// Run the next count actions of the program back to back, for the synced core. The caller has
+// started the cycle of the first (master_clock and the ppu dots), each action ends its cycle.
+// The interrupt lines are not polled in between: only the poll in the last cycle of an
+// instruction counts, and that cycle runs through cpu_step.
+void execute_program_actions(nes_state *state, uint8_t count) {
+    uint8_t action = state->cpu->program[state->cpu->next_action++];
+    run_actions(state, action, count - 1);
+    state->cpu->cpu_cycle++;
+}
 
+void add_stall_cycle(nes_state *state) {
+    state->cpu->stall_cycles++;
+}
 
+// An OAM DMA waits a cycle more when it starts on an odd cycle, to line up with the reads.
+// Called with cpu_cycle at the first cycle after the instruction that started it, in every core.
+void align_oam_dma(nes_state *state) {
+    state->cpu->oam_dma_align = false;
+    state->cpu->stall_cycles += state->cpu->cpu_cycle & 1;
+}
 
+// Done when every action of the program and every stall cycle added on the way has been executed
+bool is_instruction_done(nes_state *state) {
+    return state->cpu->next_action == state->cpu->program_length && state->cpu->stall_cycles == 0;
+}
 
-
-void add_instruction_to_queue(nes_state *state) {
-    // Check for interrupts!
-    if (state->ppu->registers->ppu_status & 128) {
-	trigger_interrupt(state);
-    }
-    // First cycle of all instructions is to fetch the opcode and inc the PC
-    add_action_to_queue(state, FETCH_OPCODE_INC_PC);
-    uint8_t opcode = read_mem(state, state->cpu->registers->PC);
-    switch (opcode) {
-	// BRK
-    case 0x00:
-	/* 2    PC     R  read next instruction byte (and throw it away), */
-        /*                increment PC */
-	add_action_to_queue(state, INC_PC);
-	/* 3  $0100,S  W  push PCH on stack, decrement S */
-	add_action_to_queue(state, PUSH_PCH_DEC_S);
-        /* 4  $0100,S  W  push PCL on stack, decrement S */
-	add_action_to_queue(state, PUSH_PCL_DEC_S);
-     /* 	If a hardware interrupt (NMI or IRQ) occurs before the fourth (flags saving) cycle of BRK,
-		the BRK instruction will be skipped, and */
-     /* the processor will jump to the hardware interrupt vector. This */
-     /* sequence will always take 7 cycles. */
-	// TODO: Implement this^ behaviour
-	/* 5  $0100,S  W  push P on stack (with B flag set), decrement S */
-	add_action_to_queue(state, PUSH_STATUS_REG_DEC_S_SET_B_FLAG);
-	/* 6   $FFFE   R  fetch PCL, set I flag */
-	add_action_to_queue(state, BRK_FETCH_PCL);
-	/* 7   $FFFF   R  fetch PCH */
-	add_action_to_queue(state, BRK_FETCH_PCH);
-	break;
-
-
-	// ORA indexed indirect, X
-    case 0x01:
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	break;
-
-
-	// *SLO indexed indirect, X - Illegal instruction
-    case 0x03:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-        /* 4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-        /* 6    address    R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7    address    W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8    address    W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-	break;
-
-// *NOP Implied - illegal opcode
-    case 0x1A:
-    case 0x3A:
-    case 0x5A:
-    case 0x7A:
-    case 0xDA:
-    case 0xFA:
-	add_action_to_queue(state, STALL_CYCLE);
-	break;
-// *NOP Immediate - illegal opcode
-    case 0x80:
-    case 0x82:
-    case 0x89:
-    case 0xC2:
-    case 0xE2:
-	add_action_to_queue(state, INC_PC);
-	break;
-
-// *NOP Zeropage - illegal opcode
-    case 0x04:
-    case 0x44:
-    case 0x64:
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, INC_PC);
-	break;
-// *NOP Absolute - illegal opcode
-    case 0x0C:
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, INC_PC);
-	add_action_to_queue(state, INC_PC);
-	break;
-
-// *NOP zeropage, X - illegal opcode
-    case 0x14:
-    case 0x34:
-    case 0x54:
-    case 0x74:
-    case 0xD4:
-    case 0xF4:
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, INC_PC);
-	break;
-
-
-	// *NOP Absolute, X - "illegal instruction"
-	// page boundary crossing should add a cycle
-    case 0x1C:
-    case 0x3C:
-    case 0x5C:
-    case 0x7C:
-    case 0xDC:
-    case 0xFC:
-	state->cpu->index_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, NOP_ABSOLUTE_X_MAYBE_STALL);
-	break;
-
-	// ORA Zero page
-    case 0x05:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, ORA_MEMORY);
-	break;
-	// ASL Zeropage
-    case 0x06:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &(state->memory[state->cpu->low_addr_byte]);
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, ASL_SOURCE_REG);
-	break;
-
-	// *SLO Zeropage - Illegal instruction
-    case 0x07:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &(state->memory[state->cpu->low_addr_byte]);
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-	break;
-
-
-
-
-	// PHP - Push Processor Status on stack
-    case 0x08:
-	/* 2    PC     R  read next instruction byte (and throw it away) */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*   3  $0100,S  W  push register on stack, decrement S */
-	add_action_to_queue(state, PUSH_STATUS_REG_DEC_SP);
-	break;
-	// ORA immediate
-    case 0x09:
-	add_action_to_queue(state, ORA_IMM_INC_PC);
-	break;
-	// ASL A
-    case 0x0A:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, ASL_SOURCE_REG);
-	break;
-	// ORA Absolute
-    case 0x0D:
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, ORA_MEMORY);
-	break;
-	// ASL Absolute
-    case 0x0E:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, ASL_MEMORY);
-	break;
-
-	// *SLO Absolute
-    case 0x0F:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-	break;
-
-
-
-	// BPL - Branch Result Plus
-    case 0x10:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (!is_negative_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// ORA indirect-indexed, Y
-    case 0x11:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	break;
-
-	// *SLO indirect-indexed, Y - Illegal instruction
-    case 0x13:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 4   pointer+1   R  fetch effective address high, */
-        /*                    add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE);
-        /* 5   address+Y*  R  read from effective address, */
-        /*                    fix high byte of effective address */
-	add_action_to_queue(state, FIX_HIGH_BYTE_NO_WRITE);
-	/* add_action_to_queue(state, STALL_CYCLE);	 */
-        /* 6   address+Y   R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7   address+Y   W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8   address+Y   W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-	break;
-
-
-
-// ORA zeropage, X
-    case 0x15:
-        /* 2     PC      R  fetch address, increment PC */
-	state->cpu->high_addr_byte = 0x0;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+I* R  read from effective address */
-	add_action_to_queue(state, ORA_MEMORY);
-	break;
-
-// ASL zero page, X
-    case 0x16:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, ASL_MEMORY);
-	break;
-
-// *SLO zero page, X - Illegal instruction
-    case 0x17:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-
-	break;
-
-
-	// CLC
-    case 0x18:
-	add_action_to_queue(state, CLEAR_CARRY_FLAG);
-	break;
-
-
-	// ORA absolute, Y
-    case 0x19:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, ORA_MEMORY);
-	break;
-
-
-	// *SLO absolute, Y - Illegal instruction
-    case 0x1B:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register Y to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	// The high byte is fixed a cycle early, so just stall here.
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-	break;
-
-
-
-	// ORA absolute, X
-    case 0x1D:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, ORA_MEMORY);
-	break;
-
-	// ASL absolute, X
-    case 0x1E:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, ASL_MEMORY);
-	break;
-
-	// *SLO absolute, X - Illegal instruction
-    case 0x1F:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	// The high byte is fixed a cycle early, so just stall here.
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, SLO_DO_ASL_THEN_ORA);
-	break;
-
-
-
-	// JSR
-    case 0x20:
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, PUSH_PCH_DEC_S);
-	add_action_to_queue(state, PUSH_PCL_DEC_S);
-	add_action_to_queue(state, COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH);
-	break;
-	// AND indexed indirect
-    case 0x21:
-	/*   2      PC       R  fetch pointer address, increment PC */
-	/*   3    pointer    R  read from the address, add X to it */
-	/*   4   pointer+X   R  fetch effective address low */
-	/*   5  pointer+X+1  R  fetch effective address high */
-	/*   6    address    R  read from effective address */
-
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	//    state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, AND_MEMORY);
-	break;
-
-	// *RLA indexed indirect - Illegal instruction
-    case 0x23:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-        /* 4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-        /* 6    address    R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7    address    W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8    address    W  write the new value to effective address */
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-
-
-	break;
-
-
-	// BIT zero page
-    case 0x24:
-	// fetch address, increment PC
-	state->cpu->high_addr_byte = 0x0;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	// Read from effective address
-	add_action_to_queue(state, BIT_READ_AFFECT_FLAGS);
-	break;
-	// AND zeropage
-    case 0x25:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, AND_MEMORY);
-	break;
-	// ROL Zeropage
-    case 0x26:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &(state->memory[state->cpu->low_addr_byte]);
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, ROL_SOURCE_REG);
-	break;
-
-	// *RLA Zeropage
-    case 0x27:
-	state->cpu->high_addr_byte = 0x0;
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-	break;
-
-
-	// PLP - Pull Process Register (flags) from stack
-    case 0x28:
-/*         2    PC     R  read next instruction byte (and throw it away) */
-	add_action_to_queue(state, STALL_CYCLE);
-/*         3  $0100,S  R  increment S */
-	add_action_to_queue(state, INC_SP);
-/*         4  $0100,S  R  pull register from stack */
-	add_action_to_queue(state, PULL_STATUS_REG_FROM_STACK_PLP);
-	break;
-
-	// AND immediate
-    case 0x29:
-	add_action_to_queue(state, AND_IMM_INC_PC);
-	break;
-	// ROL A
-    case 0x2A:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, ROL_SOURCE_REG);
-	break;
-	// BIT Absolute
-    case 0x2C:
-	/* state->cpu->destination_reg = &state->cpu->registers->Y; */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, BIT_READ_AFFECT_FLAGS);
-	break;
-
-	// AND Absolute
-    case 0x2D:
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, AND_MEMORY);
-	break;
-
-	// ROL Absolute
-    case 0x2E:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        5  address  W  write the value back to effective address, */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*                       and do the operation on it */
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, ROL_MEMORY);
-	break;
-
-	// *RLA Absolute - Illegal instruction
-    case 0x2F:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        5  address  W  write the value back to effective address, */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*                       and do the operation on it */
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-	break;
-
-
-	// BMI - Branch Result Minus
-    case 0x30:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (!is_zero_flag_set(state) && is_negative_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// AND indirect-indexed, Y
-    case 0x31:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	/*      Notes: The effective address is always fetched from zero page, */
-	/*             i.e. the zero page boundary crossing is not handled. */
-	/*             * The high byte of the effective address may be invalid */
-	/*               at this time, i.e. it may be smaller by $100. */
-	/*             + This cycle will be executed only if the effective address */
-	/*               was invalid during cycle #5, i.e. page boundary was crossed. */
-	break;
-
-	// *RLA indirect-indexed, Y - Illegal instruction
-    case 0x33:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-       /*  2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-       /*  3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-       /*  4   pointer+1   R  fetch effective address high, */
-       /*                     add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE);
-       /*  5   address+Y*  R  read from effective address, */
-       /*                     fix high byte of effective address */
-	add_action_to_queue(state, FIX_HIGH_BYTE_NO_WRITE);
-       /*  6   address+Y   R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-       /*  7   address+Y   W  write the value back to effective address, */
-       /*                     and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-       /*  8   address+Y   W  write the new value to effective address */
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-	break;
-
-
-	// AND zeropage, X
-    case 0x35:
-	/* 2     PC      R  fetch address, increment PC */
-	state->cpu->high_addr_byte = 0x0;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/* 3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/* 4  address+I* R  read from effective address */
-	add_action_to_queue(state, AND_MEMORY);
-	break;
-
-// ROL zero page, X
-    case 0x36:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, ROL_MEMORY);
-	break;
-
-// *RLA zero page, X - Illegal instruction
-    case 0x37:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-	break;
-
-
-
-	// SEC - set carry flag
-    case 0x38:
-	add_action_to_queue(state, SET_CARRY_FLAG);
-	break;
-
-	// AND absolute, Y
-    case 0x39:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->Y;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, AND_MEMORY);
-
-	break;
-
-	// *RLA absolute, Y
-    case 0x3B:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	state->cpu->index_reg = &state->cpu->registers->Y;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-	break;
-
-
-	// AND absolute, X
-    case 0x3D:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, AND_MEMORY);
-	break;
-
-	// ROL absolute, X
-    case 0x3E:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, ROL_MEMORY);
-	break;
-
-	// *RLA absolute, X
-    case 0x3F:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, RLA_DO_ROL_THEN_AND);
-	break;
-
-
-	// RTI - Return from interrupt
-    case 0x40:
-	/* 2    PC     R  read next instruction byte (and throw it away) */
-	add_action_to_queue(state, STALL_CYCLE); // doesn't read, just drones for one cycle
-	/*   3  $0100,S  R  increment S */
-	add_action_to_queue(state, INC_SP);
-	/*   4  $0100,S  R  pull P from stack, increment S */
-	add_action_to_queue(state, PULL_STATUS_REG_FROM_STACK_RTI);
-
-	/*   5  $0100,S  R  pull PCL from stack, increment S */
-	add_action_to_queue(state, PULL_PCL_FROM_STACK_INC_SP);
-	/*   6  $0100,S  R  pull PCH from stack */
-	add_action_to_queue(state, PULL_PCH_FROM_STACK);
-	break;
-
-	// EOR indexed indirect
-    case 0x41:
-	/*   2      PC       R  fetch pointer address, increment PC */
-	/*   3    pointer    R  read from the address, add X to it */
-	/*   4   pointer+X   R  fetch effective address low */
-	/*   5  pointer+X+1  R  fetch effective address high */
-	/*   6    address    R  read from effective address */
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	//    state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, EOR_MEMORY);
-	break;
-
-	// *SRE indexed indirect, X - Illegal instruction
-	// Shift right one bit in memory, then EOR accumulator with memory.
-    case 0x43:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-        /* 4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-        /* 6    address    R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7    address    W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8    address    W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-
-
-	// EOR zeropage
-    case 0x45:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, 32);
-	break;
-
-	// LSR Zeropage
-    case 0x46:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &(state->memory[state->cpu->low_addr_byte]);
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, LSR_SOURCE_REG);
-	break;
-
-	// *SRE Zeropage
-    case 0x47:
-	state->cpu->high_addr_byte = 0x0;
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-
-	// PHA - Push ACC to stack
-    case 0x48:
-	/* R  read next instruction byte (and throw it away) */
-	add_action_to_queue(state, STALL_CYCLE);
-	/* W  push register on stack, decrement S */
-	add_action_to_queue(state, PUSH_ACC_DEC_SP);
-	break;
-	// EOR immediate
-    case 0x49:
-	add_action_to_queue(state, EOR_IMM_INC_PC);
-	break;
-
-	// LSR A - Logical Shift Right accumulator
-    case 0x4A:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, LSR_SOURCE_REG);
-	break;
-
-	// JMP immediate
-    case 0x4C:
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH);
-	break;
-	// EOR Absolute
-    case 0x4D:
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, 32);
-	break;
-
-	// LSR Absolute
-    case 0x4E:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, LSR_MEMORY);
-	break;
-
-	// *SRE Absolute - Illegal instruction
-    case 0x4F:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-
-	// BVC - Branch Overflow clear
-    case 0x50:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (!is_overflow_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// EOR indirect-indexed, Y
-    case 0x51:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	break;
-
-	// *SRE indirect-indexed, Y
-    case 0x53:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 4   pointer+1   R  fetch effective address high, */
-        /*                    add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE);
-        /* 5   address+Y*  R  read from effective address, */
-        /*                    fix high byte of effective address */
-	add_action_to_queue(state, FIX_HIGH_BYTE_NO_WRITE);
-        /* 6   address+Y   R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7   address+Y   W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8   address+Y   W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-
-	// EOR zeropage, X
-    case 0x55:
-	/* 2     PC      R  fetch address, increment PC */
-	state->cpu->high_addr_byte = 0x0;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/* 3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/* 4  address+I* R  read from effective address */
-	add_action_to_queue(state, EOR_MEMORY);
-	break;
-
-
-// LSR zero page, X
-    case 0x56:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, LSR_MEMORY);
-	break;
-
-
-    // *SRE zero page, X
-    case 0x57:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-
-	// EOR absolute, Y
-    case 0x59:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->Y;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, EOR_MEMORY);
-	break;
-
-	// *SRE absolute, Y - Illegal instruction
-    case 0x5B:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register Y to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	// The high byte is fixed a cycle early, so just stall here.
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-
-	// EOR absolute, X
-    case 0x5D:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, EOR_MEMORY);
-	break;
-
-	// LSR absolute, X
-    case 0x5E:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, LSR_MEMORY);
-	break;
-
-	// *SRE absolute, X - Illegal instruction
-    case 0x5F:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register Y to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	// The high byte is fixed a cycle early, so just stall here.
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, SRE_DO_LSR_THEN_EOR_ACC);
-	break;
-
-	// RTS - Return from subroutine
-    case 0x60:
-	/*  #  address R/W description */
-	/* --- ------- --- ----------------------------------------------- */
-	/*  1    PC     R  fetch opcode, increment PC */
-	/*  2    PC     R  read next instruction byte (and throw it away) */
-	add_action_to_queue(state, STALL_CYCLE); // doesn't read, just drones for one cycle
-	/*  3  $0100,S  R  increment S */
-	add_action_to_queue(state, INC_SP);
-	/*  4  $0100,S  R  pull PCL from stack, increment S */
-	add_action_to_queue(state, PULL_PCL_FROM_STACK_INC_SP);
-	/*  5  $0100,S  R  pull PCH from stack */
-	add_action_to_queue(state, PULL_PCH_FROM_STACK);
-	/*  6    PC     R  increment PC */
-	add_action_to_queue(state, INC_PC);
-	break;
-
-	// PLA - Pull Accumulator from stack
-    case 0x68:
-	/*         2    PC     R  read next instruction byte (and throw it away) */
-	add_action_to_queue(state, STALL_CYCLE);
-/*         3  $0100,S  R  increment S */
-	add_action_to_queue(state, INC_SP);
-/*         4  $0100,S  R  pull register from stack */
-	add_action_to_queue(state, PULL_ACC_FROM_STACK_AFFECT_FLAGS);
-	break;
-	// ADC indexed indirect
-    case 0x61:
-	/*   2      PC       R  fetch pointer address, increment PC */
-	/*   3    pointer    R  read from the address, add X to it */
-	/*   4   pointer+X   R  fetch effective address low */
-	/*   5  pointer+X+1  R  fetch effective address high */
-	/*   6    address    R  read from effective address */
-
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	//    state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, ADC_MEMORY);
-	break;
-
-	// *RRA indexed indirect - Illegal instruction
-/* Rotate one bit right in memory, then add memory to accumulator (with */
-/* carry). */
-    case 0x63:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-        /* 4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-        /* 6    address    R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7    address    W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8    address    W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-
-	break;
-
-
-	// ADC zeropage
-    case 0x65:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, ADC_MEMORY);
-	break;
-
-	// ROR Zeropage
-    case 0x66:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &(state->memory[state->cpu->low_addr_byte]);
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, ROR_SOURCE_REG);
-	break;
-
-	// *RRA Zeropage
-    case 0x67:
-	state->cpu->high_addr_byte = 0x0;
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-	break;
-
-
-	// ADC Immediate
-    case 0x69:
-	add_action_to_queue(state, ADC_IMM_INC_PC);
-	break;
-	// ROR A
-    case 0x6A:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, ROR_SOURCE_REG);
-
-	break;
-
-
-	// JMP Absolute indirect
-    case 0x6C:
-	/* #   address  R/W description */
-	/*     --- --------- --- ------------------------------------------ */
-	/*     1     PC      R  fetch opcode, increment PC */
-	/*       2     PC      R  fetch pointer address low, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3     PC      R  fetch pointer address high, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*       4   pointer   R  fetch low address to latch */
-	add_action_to_queue(state, FETCH_LOW_ADDR_TO_LATCH);
-	/*       5  pointer+1* R  fetch PCH, copy latch to PCL */
-	add_action_to_queue(state, FETCH_PCH_COPY_LATCH_TO_PCL);
-	/* Note: * The PCH will always be fetched from the same page */
-	/*     than PCL, i.e. page boundary crossing is not handled. */
-
-
-	break;
-
-	// ADC Absolute
-    case 0x6D:
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, ADC_MEMORY);
-	break;
-
-	// ROR Absolute
-    case 0x6E:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        5  address  W  write the value back to effective address, */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*                       and do the operation on it */
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, ROR_MEMORY);
-	break;
-
-	// *RRA Absolute
-    case 0x6F:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*        5  address  W  write the value back to effective address, */
-	add_action_to_queue(state, STALL_CYCLE); // Stall
-	/*                       and do the operation on it */
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-	break;
-
-
-	// BVS - Branch Overflow Set
-    case 0x70:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (is_overflow_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// ADC indirect-indexed, Y
-    case 0x71:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	break;
-
-	// *RRA indirect-indexed, Y
-    case 0x73:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /* 3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-        /* 4   pointer+1   R  fetch effective address high, */
-        /*                    add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE);
-        /* 5   address+Y*  R  read from effective address, */
-        /*                    fix high byte of effective address */
-	add_action_to_queue(state, FIX_HIGH_BYTE_NO_WRITE);
-        /* 6   address+Y   R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7   address+Y   W  write the value back to effective address, */
-        /*                    and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 8   address+Y   W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-	break;
-
-
-
-	// ADC zeropage, X
-    case 0x75:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/* 3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/* 4  address+I* R  read from effective address */
-	add_action_to_queue(state, ADC_MEMORY);
-	break;
-
-// ROR zero page, X
-    case 0x76:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, ROR_MEMORY);
-
-	break;
-
-// *RRA zero page, X
-    case 0x77:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-
-	break;
-
-
-
-	// SEI - Set Interrupt Flag
-    case 0x78:
-	add_action_to_queue(state, SET_INTERRUPT_FLAG);
-	break;
-
-
-	// ADC absolute, Y
-    case 0x79:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->Y;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, ADC_MEMORY);
-	break;
-
-	// *RRA absolute, Y - Illegal instruction
-    case 0x7B:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register Y to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	// The high byte is fixed a cycle early, so just stall here.
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-	break;
-
-
-
-	// ADC absolute, X
-    case 0x7D:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, ADC_MEMORY);
-	break;
-
-	// ROR absolute, X
-    case 0x7E:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, ROR_MEMORY);
-	break;
-
-	// *RRA absolute, X - Illegal instruction
-    case 0x7F:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register Y to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	// The high byte is fixed a cycle early, so just stall here.
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, RRA_DO_ROR_THEN_ADC);
-	break;
-
-	// STA indirect, X (indexed indirect)
-    case 0x81:
-	/*        2      PC       R  fetch pointer address, increment PC */
-	/*        3    pointer    R  read from the address, add X to it */
-	/*        4   pointer+X   R  fetch effective address low */
-	/*        5  pointer+X+1  R  fetch effective address high */
-	/*        6    address    W  write to effective address */
-
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE);
-
-	break;
-
-	// *SAX indirect, X (indexed indirect) - Illegal instruction, ACC AND X -> Memory
-    case 0x83:
-	/*        2      PC       R  fetch pointer address, increment PC */
-	/*        3    pointer    R  read from the address, add X to it */
-	/*        4   pointer+X   R  fetch effective address low */
-	/*        5  pointer+X+1  R  fetch effective address high */
-	/*        6    address    W  write to effective address */
-
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	// Here we do and AND operation on ACC and X and store in memory
-	add_action_to_queue(state, SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS);
-	break;
-
-
-	// STY Zeropage
-    case 0x84:
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_ZEROPAGE);
-	break;
-
-	// STA Zeropage
-    case 0x85:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_ZEROPAGE);
-	break;
-
-	// STX Zeropage
-    case 0x86:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_ZEROPAGE);
-	break;
-
-	// *SAX Zeropage - Illegal instruction
-    case 0x87:
-	state->cpu->high_addr_byte = 0;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS);
-	break;
-
-
-
-	// DEC - Decrement Y register
-    case 0x88:
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, DEC_SOURCE_REG);
-	break;
-	// STY Absolute
-    case 0x8C:
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	/*       2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*       4  address  W  write register to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE);
-	break;
-
-	// STA Absolute
-    case 0x8D:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/*       2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*       4  address  W  write register to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE);
-	break;
-
-	// STX Absolute
-    case 0x8E:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	/*       2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*       4  address  W  write register to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE);
-	break;
-
-	// *SAX Absolute - Illegal instruction
-    case 0x8F:
-	/*       2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*       4  address  W  write register to effective address */
-	add_action_to_queue(state, SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS);
-	break;
-
-
-	// TXA
-    case 0x8A:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS);
-	break;
-	// BCC - Branch Carry Clear
-    case 0x90:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (!is_carry_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// STA indirect-indexed, Y
-    case 0x91:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/* #    address   R/W description */
-	/*     --- ----------- --- ------------------------------------------ */
-	/*      1      PC       R  fetch opcode, increment PC */
-	/*      2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*      3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*      4   pointer+1   R  fetch effective address high, */
-	/*                         add Y to low byte of effective address */
-
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	add_action_to_queue(state, STALL_CYCLE);
-	/*      5   address+Y*  R  read from effective address, */
-	/*                         fix high byte of effective address */
-
-	/*      6   address+Y   W  write to effective address */
-	add_action_to_queue(state, STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*     Notes: The effective address is always fetched from zero page, */
-	/*            i.e. the zero page boundary crossing is not handled. */
-
-	/*            * The high byte of the effective address may be invalid */
-	/*              at this time, i.e. it may be smaller by $100. */
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-
-	/*       3    pointer    R  fetch effective address low */
-
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	break;
-
-
-// STY zero page, X
-    case 0x94:
-        /* 2     PC      R  fetch address, increment PC */
-        /* 3   address   R  read from address, add index register to it */
-        /* 4  address+I* W  write to effective address */
-
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  Write to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_ZEROPAGE);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-
-	break;
-
-
-// STA zero page, X
-    case 0x95:
-        /* 2     PC      R  fetch address, increment PC */
-        /* 3   address   R  read from address, add index register to it */
-        /* 4  address+I* W  write to effective address */
-
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  Write to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_ZEROPAGE);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-	break;
-
-// STX zero page, Y
-    case 0x96:
-        /* 2     PC      R  fetch address, increment PC */
-        /* 3   address   R  read from address, add index register to it */
-        /* 4  address+I* W  write to effective address */
-
-	state->cpu->source_reg = &state->cpu->registers->X;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  Write to effective address */
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_ZEROPAGE);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-
-	break;
-
-// *SAX zero page, Y - Illegal instruction
-    case 0x97:
-        /* 2     PC      R  fetch address, increment PC */
-        /* 3   address   R  read from address, add index register to it */
-        /* 4  address+I* W  write to effective address */
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  Write to effective address */
-	add_action_to_queue(state, SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-	break;
-
-	// TYA
-    case 0x98:
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS);
-	break;
-	// STA absolute, Y
-    case 0x99:
-	// TODO - fix this mess
-	/*  2     PC      R  fetch low byte of address, increment PC */
-	/*  3     PC      R  fetch high byte of address, add index register to low address byte, increment PC */
-	/*  4  address+I* R  read from effective address, fix the high byte of effective address */
-	/*  5  address+I  W  write to effective address */
-	/* Notes: I denotes either index register (X or Y). */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE);
-	break;
-
-
-
-	// TXS - Transfer X to Stack Pointer, affect no flags
-    case 0x9A:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	state->cpu->destination_reg = &state->cpu->registers->SP;
-	add_action_to_queue(state, COPY_SOURCE_REG_TO_DEST_REG_NO_FLAGS);
-	break;
-
-	// STA Absolute, X
-    case 0x9D:
-	/*  2     PC      R  fetch low byte of address, increment PC */
-	/*  3     PC      R  fetch high byte of address, add index register to low address byte, increment PC */
-	/*  4  address+I* R  read from effective address, fix the high byte of effective address */
-	/*  5  address+I  W  write to effective address */
-	/* Notes: I denotes either index register (X or Y). */
-
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	add_action_to_queue(state, WRITE_REG_TO_EFF_ADDR_NON_ZEROPAGE);
-	break;
-
-
-	// LDY Immediate
-    case 0xA0:
-	state->cpu->destination_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, 4);
-	break;
-
-	// LDA indirect,x
-    case 0xA1:
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/* add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer */
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    R  read from effective address */
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// LDX Immediate
-    case 0xA2:
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_VALUE_SAVE_TO_DEST);
-	break;
-
-
-	// LAX indirect,x - illegal, combines LDA and LDX
-    case 0xA3:
-	/* state->cpu->high_addr_byte = 0x0; */
-	/* state->cpu->low_addr_byte = 0x0; */
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    R  read from effective address */
-	add_action_to_queue(state, LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS);
-	break;
-
-
-
-	// LDY Zero page
-    case 0xA4:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->Y;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// LDA Zero page
-    case 0xA5:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-
-	// *LAX Zero page - illegal instruction
-    case 0xA7:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-
-	add_action_to_queue(state, LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS);
-	break;
-
-
-	// LDX Zero page
-    case 0xA6:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// TAY
-    case 0xA8:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS);
-	break;
-	// LDA Immediate
-    case 0xA9:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, 4);
-	break;
-
-	// TAX
-    case 0xAA:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// LDY Absolute
-    case 0xAC:
-	state->cpu->destination_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// LDA Absolute
-    case 0xAD:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// LDX Absolute
-    case 0xAE:
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// *LAX Absolute - Illegal opcode
-    case 0xAF:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS);
-	break;
-
-	// BCS
-    case 0xB0:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (is_carry_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// LDA indirect-indexed, Y
-    case 0xB1:
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	/*      Notes: The effective address is always fetched from zero page, */
-	/*             i.e. the zero page boundary crossing is not handled. */
-
-	/*             * The high byte of the effective address may be invalid */
-	/*               at this time, i.e. it may be smaller by $100. */
-
-	/*             + This cycle will be executed only if the effective address */
-	/*               was invalid during cycle #5, i.e. page boundary was crossed. */
-	break;
-
-
-	// *LAX indirect-indexed, Y - Illegal instruction
-    case 0xB3:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	/*      Notes: The effective address is always fetched from zero page, */
-	/*             i.e. the zero page boundary crossing is not handled. */
-
-	/*             * The high byte of the effective address may be invalid */
-	/*               at this time, i.e. it may be smaller by $100. */
-
-	/*             + This cycle will be executed only if the effective address */
-	/*               was invalid during cycle #5, i.e. page boundary was crossed. */
-	break;
-
-
-
-// LDY zero page, X
-    case 0xB4:
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->destination_reg = &state->cpu->registers->Y;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  read from effective address */
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-
-	break;
-
-// LDA zero page, X
-    case 0xB5:
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  read from effective address */
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	/* Notes: I denotes either index register (X or Y). */
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-	break;
-
-
-// LDX zero page, Y
-    case 0xB6:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-
-	/* state->cpu->source_reg = &state->cpu->registers->Y; */
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  read from effective address */
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-
-	break;
-
-
-// *LAX zero page, Y - Illegal instruction
-    case 0xB7:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/*  2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*  3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/*  4  address+I* R  read from effective address */
-	add_action_to_queue(state, LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS);
-	/* Notes: I denotes either index register (X or Y). */
-
-	/*        * The high byte of the effective address is always zero, */
-	/*          i.e. page boundary crossings are not handled. */
-
-	break;
-
-
-
-// CLV - Clear Overflow Flag
-    case 0xB8:
-	add_action_to_queue(state, CLEAR_OVERFLOW_FLAG);
-	break;
-
-// LDA Indexed Absolute Y
-    case 0xB9:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* state->cpu->source_reg = &state->cpu->registers->Y; */
-	/* 2     PC      R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3     PC      R  fetch high byte of address, add index register to low address byte, increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	/*        4  address+Y* R  read from effective address,fix the high byte of effective address */
-
-	add_action_to_queue(state, READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/* add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);       */
-	/*        5+ address+Y  R  re-read from effective address */
-	/*              * The high byte of the effective address may be invalid */
-	/*                at this time, i.e. it may be smaller by $100. */
-	/*              + This cycle will be executed only if the effective address */
-	/*                was invalid during cycle #4, i.e. page boundary was crossed. */
-
-	break;
-
-	// TSX - Transfer SP to X
-    case 0xBA:
-	state->cpu->source_reg = &state->cpu->registers->SP;
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, COPY_SOURCE_REG_TO_DEST_REG_AFFECT_NZ_FLAGS);
-	break;
-
-
-
-// LDY Indexed Absolute X
-    case 0xBC:
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->destination_reg = &state->cpu->registers->Y;
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	/* 2     PC      R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3     PC      R  fetch high byte of address, add index register to low address byte, increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	/*        4  address+Y* R  read from effective address,fix the high byte of effective address */
-
-	add_action_to_queue(state, READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/* add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);       */
-	/*        5+ address+Y  R  re-read from effective address */
-	/*              * The high byte of the effective address may be invalid */
-	/*                at this time, i.e. it may be smaller by $100. */
-	/*              + This cycle will be executed only if the effective address */
-	/*                was invalid during cycle #4, i.e. page boundary was crossed. */
-	break;
-
-	// LDA absolute, X
-    case 0xBD:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-	// LDX absolute, Y
-    case 0xBE:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->X;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, READ_EFF_ADDR_STORE_IN_REG_AFFECT_NZ_FLAGS);
-	break;
-
-
-	// *LAX absolute, Y - Illegal instruction
-    case 0xBF:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS);
-	break;
-
-	// CPY Immediate
-    case 0xC0:
-	add_action_to_queue(state, CPY_IMM_INC_PC);
-	break;
-
-	// CMP indexed indirect
-    case 0xC1:
-	/*   2      PC       R  fetch pointer address, increment PC */
-	/*   3    pointer    R  read from the address, add X to it */
-	/*   4   pointer+X   R  fetch effective address low */
-	/*   5  pointer+X+1  R  fetch effective address high */
-	/*   6    address    R  read from effective address */
-
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// *DCP indexed indirect, X - Illegal instruction
-	// Equivalent to DEC value followed by CMP value
-    case 0xC3:
-	/*  2      PC       R  fetch pointer address, increment PC */
-	/*  3    pointer    R  read from the address, add X to it */
-	/*  4   pointer+X   R  fetch effective address low */
-	/*  5  pointer+X+1  R  fetch effective address high */
-	/*  6    address    R  read from effective address */
-	/*  7    address    W  write the value back to effective address, */
-	/*                     and do the operation on it */
-	/*  8    address    W  write the new value to effective address */
-
-	/* Note: The effective address is always fetched from zero page, */
-	/*       i.e. the zero page boundary crossing is not handled. */
-
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*  6    address    R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*  7    address    W  write the value back to effective address, */
-	/*                     and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*  8    address    W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-
-	break;
-
-
-	// CPY zeropage
-    case 0xC4:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-	// CMP zeropage
-    case 0xC5:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// DEC Zeropage
-    case 0xC6:
-	state->cpu->high_addr_byte = 0x0;
-	// This should probably happen after the actions :(
-	/* state->cpu->source_reg = &state->memory[ state->cpu->low_addr_byte]; */
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, DEC_MEMORY);
-	break;
-
-	// *DCP Zeropage - Illegal instruction
-    case 0xC7:
-	state->cpu->high_addr_byte = 0x0;
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-	break;
-
-
-	// INY - Increment Y register
-    case 0xC8:
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, INC_SOURCE_REG);
-	break;
-	// CMP Acc immediate
-    case 0xC9:
-	add_action_to_queue(state, CMP_IMM_INC_PC);
-	break;
-	// DEX - Decrement X register
-    case 0xCA:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, DEC_SOURCE_REG);
-	break;
-
-	// CPY Absolute
-    case 0xCC:
-	state->cpu->source_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// CMP Absolute
-    case 0xCD:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// DEC Absolute
-    case 0xCE:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, DEC_MEMORY);
-	break;
-
-	// *DCP Absolute - Illegal instruction
-    case 0xCF:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-	break;
-
-
-	// BNE
-    case 0xD0:
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (!is_zero_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	// TODO : Add extra action for crossing page boundary
-	break;
-
-	// CMP indirect-indexed, Y
-    case 0xD1:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	break;
-
-	// *DCP indirect-indexed, Y
-    case 0xD3:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-       /*  2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-       /*  3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-       /*  4   pointer+1   R  fetch effective address high, */
-       /*                     add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE);
-       /*  5   address+Y*  R  read from effective address, */
-       /*                     fix high byte of effective address */
-	add_action_to_queue(state, FIX_HIGH_BYTE_NO_WRITE);
-       /*  6   address+Y   R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-       /*  7   address+Y   W  write the value back to effective address, */
-       /*                     and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-       /*  8   address+Y   W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-       /* Notes: The effective address is always fetched from zero page, */
-       /*        i.e. the zero page boundary crossing is not handled. */
-
-       /*        * The high byte of the effective address may be invalid */
-       /*          at this time, i.e. it may be smaller by $100. */
-	break;
-
-
-	// CMP zeropage, X
-    case 0xD5:
-	/* 2     PC      R  fetch address, increment PC */
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->high_addr_byte = 0x0;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/* 3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/* 4  address+I* R  read from effective address */
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-// DEC zero page, X
-    case 0xD6:
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->high_addr_byte = 0;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, DEC_MEMORY);
-
-	break;
-
-// *DCP zero page, X - Illegal instruction
-    case 0xD7:
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->high_addr_byte = 0;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-
-	break;
-
-
-
-
-	// CLD - Clear Decimal Flag
-    case 0xD8:
-	add_action_to_queue(state, CLEAR_DECIMAL_FLAG);
-	break;
-
-	// CMP absolute, Y
-    case 0xD9:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-
-
-	// *DCP absolute, Y - Illegal instruction
-    case 0xDB:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register X to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-	break;
-
-
-
-
-    // CMP absolute, X
-    case 0xDD:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// DEC absolute, X
-    case 0xDE:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, DEC_MEMORY);
-	break;
-
-	// *DCP absolute, X - Illegal instruction
-    case 0xDF:
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2    PC       R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3    PC       R  fetch high byte of address, */
-        /*                  add index register X to low address byte, */
-        /*                  increment PC */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-        /* 4  address+X* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X  R  re-read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X  W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 7  address+X  W  write the new value to effective address */
-	add_action_to_queue(state, DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY);
-	break;
-
-
-
-	// CPX Immediate
-    case 0xE0:
-	add_action_to_queue(state, CPX_IMM_INC_PC);
-	break;
-
-	// SBC indexed indirect
-    case 0xE1:
-	/*   2      PC       R  fetch pointer address, increment PC */
-	/*   3    pointer    R  read from the address, add X to it */
-	/*   4   pointer+X   R  fetch effective address low */
-	/*   5  pointer+X+1  R  fetch effective address high */
-	/*   6    address    R  read from effective address */
-
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->low_addr_byte = 0x0;
-	//    state->cpu->source_reg = &state->cpu->registers->ACC;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, INC_PC); // increment PC, nowhere to store pointer
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*   6    address    W  write ACC to effective address */
-	add_action_to_queue(state, SBC_MEMORY);
-	break;
-
-
-	// *ISB indexed indirect, X - Illegal instruction
-	// Inc Memory followed by SBC memory
-    case 0xE3:
-	/*  2      PC       R  fetch pointer address, increment PC */
-	/*  3    pointer    R  read from the address, add X to it */
-	/*  4   pointer+X   R  fetch effective address low */
-	/*  5  pointer+X+1  R  fetch effective address high */
-	/*  6    address    R  read from effective address */
-	/*  7    address    W  write the value back to effective address, */
-	/*                     and do the operation on it */
-	/*  8    address    W  write the new value to effective address */
-	/* Note: The effective address is always fetched from zero page, */
-	/*       i.e. the zero page boundary crossing is not handled. */
-
-	state->cpu->index_reg = &state->cpu->registers->X;
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	/* 2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*   3    pointer    R  read from the address, add X to it */
-	add_action_to_queue(state, READ_ADDR_ADD_INDEX_STORE_IN_OPERAND);
-	/*   4   pointer+X   R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*   5  pointer+X+1  R  fetch effective address high */
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH);
-	/*  6    address    R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*  7    address    W  write the value back to effective address, */
-	/*                     and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-	/*  8    address    W  write the new value to effective address */
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-
-	break;
-
-
-	// CPX zeropage
-    case 0xE4:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->source_reg = &state->cpu->registers->X;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// SBC zeropage
-    case 0xE5:
-	// Clear out high addr byte, to ensure zero-page read
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* 2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*       3  address  R  read from effective address */
-	add_action_to_queue(state, SBC_MEMORY);
-	break;
-
-	// INC Zeropage
-    case 0xE6:
-	state->cpu->high_addr_byte = 0x0;
-	// This should probably happen after the actions :(
-	/* state->cpu->source_reg = &state->memory[ state->cpu->low_addr_byte]; */
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, INC_MEMORY);
-	break;
-
-	// *ISB Zeropage - Illegal instruction
-    case 0xE7:
-	state->cpu->high_addr_byte = 0x0;
-	// This should probably happen after the actions :(
-	/* state->cpu->source_reg = &state->memory[ state->cpu->low_addr_byte]; */
-	/*   2    PC     R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*   3  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall for one cycle, no need to read
-	/*   4  address  W  write the value back to effective address, */
-	/*   and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // // Stall for one cycle, no need to write
-	/*   5  address  W  write the new value to effective address */
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-	break;
-
-
-	// INX - Increment X register
-    case 0xE8:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, INC_SOURCE_REG);
-	break;
-
-	// SBC Immediate
-    case 0xE9:
-	add_action_to_queue(state, SBC_IMM_INC_PC);
-	break;
-
-	// NOP
-    case 0xEA:
-	add_action_to_queue(state, STALL_CYCLE);
-	break;
-
-// SBC Immediate (Illegal opcode)
-    case 0xEB:
-	add_action_to_queue(state, SBC_IMM_INC_PC);
-	break;
-
-	// CPX Absolute
-    case 0xEC:
-	state->cpu->source_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, CMP_MEMORY);
-	break;
-
-	// SBC Absolute
-    case 0xED:
-	state->cpu->source_reg = &state->cpu->registers->ACC;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	// Read from effective address, copy to register
-	add_action_to_queue(state, SBC_MEMORY);
-	break;
-
-	// INC Absolute
-    case 0xEE:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, INC_MEMORY);
-	break;
-
-	// *ISB Absolute - Illegal instruction
-    case 0xEF:
-	/* 2    PC     R  fetch low byte of address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/*        3    PC     R  fetch high byte of address, increment PC */
-	add_action_to_queue(state, FETCH_HIGH_ADDR_BYTE_INC_PC);
-	/*        4  address  R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        5  address  W  write the value back to effective address, */
-	/*                       and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE); // Stall, no need to read
-	/*        6  address  W  write the new value to effective address */
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-	break;
-
-
-	// BEQ
-    case 0xF0:
-       /*  2     PC      R  fetch operand, increment PC */
-       /*  3     PC      R  Fetch opcode of next instruction, */
-       /*                   If branch is taken, add operand to PCL. */
-       /*                   Otherwise increment PC. */
-       /*  4+    PC*     R  Fetch opcode of next instruction. */
-       /*                   Fix PCH. If it did not change, increment PC. */
-       /*  5!    PC      R  Fetch opcode of next instruction, */
-       /*                   increment PC. */
-       /* Notes: The opcode fetch of the next instruction is included to */
-       /*        this diagram for illustration purposes. When determining */
-       /*        real execution times, remember to subtract the last */
-       /*        cycle. */
-       /*        * The high byte of Program Counter (PCH) may be invalid */
-       /*          at this time, i.e. it may be smaller or bigger by $100. */
-       /*        + If branch is taken, this cycle will be executed. */
-       /*        ! If branch occurs to different page, this cycle will be */
-       /*          executed. */
-
-	add_action_to_queue(state, FETCH_OPERAND_INC_PC);
-	if (is_zero_flag_set(state)) {
-	    add_action_to_queue(state, ADD_OPERAND_TO_PCL);
-	}
-	break;
-
-	// SBC indirect-indexed, Y
-    case 0xF1:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* #    address   R/W description */
-	/*      --- ----------- --- ------------------------------------------ */
-	/*       1      PC       R  fetch opcode, increment PC */
-	/*       2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-	/*       3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-	/*       4   pointer+1   R  fetch effective address high, */
-	/*                          add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX);
-	/*       5   address+Y*  R  read from effective address, */
-	/*                          fix high byte of effective address */
-	add_action_to_queue(state, SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	break;
-
-	// *ISB indirect-indexed, Y - Illegal instruction
-    case 0xF3:
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-
-       /*  2      PC       R  fetch pointer address, increment PC */
-	add_action_to_queue(state, FETCH_ZP_PTR_ADDR_INC_PC);
-        /*  3    pointer    R  fetch effective address low */
-	add_action_to_queue(state, FETCH_EFF_ADDR_LOW);
-       /*  4   pointer+1   R  fetch effective address high, */
-       /*                     add Y to low byte of effective address */
-	add_action_to_queue(state, FETCH_HIGH_BYTE_ADDR_ADD_INDEX_NO_EXTRA_CYCLE);
-       /*  5   address+Y*  R  read from effective address, */
-       /*                     fix high byte of effective address */
-	/* add_action_to_queue(state, SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE);	 */
-	add_action_to_queue(state, FIX_HIGH_BYTE_NO_WRITE);
-       /*  6   address+Y   R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-       /*  7   address+Y   W  write the value back to effective address, */
-       /*                     and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /*  8   address+Y   W  write the new value to effective address */
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-       /* Notes: The effective address is always fetched from zero page, */
-       /*        i.e. the zero page boundary crossing is not handled. */
-
-       /*        * The high byte of the effective address may be invalid */
-       /*          at this time, i.e. it may be smaller by $100. */
-
-
-
-
-
-
-
-	/*       6+  address+Y   R  read from effective address */
-	// ^Will be added in 313 if necessary
-	break;
-
-
-
-	// SBC zeropage, X
-    case 0xF5:
-	/* 2     PC      R  fetch address, increment PC */
-	state->cpu->high_addr_byte = 0x0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	/* 3   address   R  read from address, add index register to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-	/* 4  address+I* R  read from effective address */
-	add_action_to_queue(state, SBC_MEMORY);
-	break;
-
-// INC zero page, X
-    case 0xF6:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, INC_MEMORY);
-	break;
-
-// *ISB zero page, X - Illegal instruction
-    case 0xF7:
-	state->cpu->high_addr_byte = 0;
-	state->cpu->index_reg = &state->cpu->registers->X;
-        /* 2     PC      R  fetch address, increment PC */
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-        /* 3   address   R  read from address, add index register X to it */
-	add_action_to_queue(state, ZEROPAGE_ADD_INDEX);
-        /* 4  address+X* R  read from effective address */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 5  address+X* W  write the value back to effective address, */
-        /*                  and do the operation on it */
-	add_action_to_queue(state, STALL_CYCLE);
-        /* 6  address+X* W  write the new value to effective address */
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-	break;
-
-
-
-	// SED - Set Decimal Flag
-    case 0xF8:
-	add_action_to_queue(state, SET_DECIMAL_FLAG);
-	break;
-
-	// SBC absolute, Y
-    case 0xF9:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	/* state->cpu->source_reg = &state->cpu->registers->Y; */
-	state->cpu->index_reg = &state->cpu->registers->Y;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, SBC_MEMORY);
-
-	break;
-
-
-
-
-	// *ISB absolute, Y - Illegal instruction
-    case 0xFB:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	state->cpu->index_reg = &state->cpu->registers->Y;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-	break;
-
-
-	// SBC absolute, X
-    case 0xFD:
-        /* 2     PC      R  fetch low byte of address, increment PC */
-        /* 3     PC      R  fetch high byte of address, */
-        /*                  add index register to low address byte, */
-        /*                  increment PC */
-        /* 4  address+I* R  read from effective address, */
-        /*                  fix the high byte of effective address */
-        /* 5+ address+I  R  re-read from effective address */
-	state->cpu->destination_reg = &state->cpu->registers->ACC;
-	state->cpu->index_reg = &state->cpu->registers->X;
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC);
-	add_action_to_queue(state, SBC_MEMORY);
-	break;
-
-	// INC absolute, X
-    case 0xFE:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, INC_MEMORY);
-	break;
-
-
-	// *ISB absolute, X - Illegal instruction
-    case 0xFF:
-	/* 2    PC       R  fetch low byte of address, increment PC */
-	/* 3    PC       R  fetch high byte of address, add index register X to low address byte, increment PC */
-	/* 4  address+X* R  read from effective address, fix the high byte of effective address */
-	/* 5  address+X  R  re-read from effective address */
-	/* 6  address+X  W  write the value back to effective address, and do the operation on it */
-	/* 7  address+X  W  write the new value to effective address */
-	/* state->cpu->destination_reg = &state->cpu->registers->ACC; */
-	/* state->cpu->source_reg = &state->cpu->registers->X; */
-	state->cpu->index_reg = &state->cpu->registers->X;
-
-	add_action_to_queue(state, FETCH_LOW_ADDR_BYTE_INC_PC);
-	add_action_to_queue(state, FETCH_EFF_ADDR_HIGH_ADD_INDEX_INC_PC_NO_EXTRA_CYCLES);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, STALL_CYCLE);
-	add_action_to_queue(state, ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY);
-	break;
-
-
-	// unimplemented instruction is a fatal error
-	// Flag it so emulation can be stopped
-    default:
+// Look up the program of the opcode at PC and point the cpu at it.
+// All programs are precomputed in microcode.c, so nothing is built here.
+static void load_program(nes_state *state) {
+    state->cpu->next_action = 0;
+    const microcode_program *program = decode_instruction(state, state->cpu->registers->PC)->program;
+    if (program == NULL) {
 	state->fatal_error = true;
 	state->running = false;
-	break;
+	program = &unknown_program;
     }
+    if (program->clear_high_addr_byte) { state->cpu->high_addr_byte = 0x0; }
+    if (program->clear_low_addr_byte) { state->cpu->low_addr_byte = 0x0; }
+    uint8_t length = program->length;
+    // Branch not taken, skip ADD_OPERAND_TO_PCL
+    if (program->branch_mask != 0) { build_status_reg(state); }
+    if ((state->cpu->registers->SR & program->branch_mask) != program->branch_value) {
+	length--;
+    }
+    state->cpu->program = program->actions;
+    state->cpu->program_length = length;
+}
 
+// Start the next instruction, or the interrupt polled in the last cycle of the one that just ended
+void start_instruction(nes_state *state) {
+    if (state->cpu->polled_interrupt != 0) {
+	trigger_interrupt(state, state->cpu->polled_interrupt);
+	return;
+    }
+    load_program(state);
 }
 
+
 // There are 3 kinds of interrupt, BRK, NMI and IRQ.
-// Currently only handle NMI
-void trigger_interrupt(nes_state *state) {
-    printf("Interrupt triggered!\n");
-/*  #  address R/W description */
-/* --- ------- --- ----------------------------------------------- */
-/*  1    PC     R  fetch opcode (and discard it - $00 (BRK) is forced into the opcode register instead) */
-    add_action_to_queue(state, STALL_CYCLE);
-/*  2    PC     R  read next instruction byte (actually the same as above, since PC increment is suppressed. Also discarded.) */
-    add_action_to_queue(state, STALL_CYCLE);
-    /*  3  $0100,S  W  push PCH on stack, decrement S */
-    add_action_to_queue(state, PUSH_PCH_DEC_S);
-/*  4  $0100,S  W  push PCL on stack, decrement S */
-    add_action_to_queue(state, PUSH_PCL_DEC_S);
-    /* *** At this point, the signal status determines which interrupt vector is used *** */
-/*  5  $0100,S  W  push P on stack (with B flag *clear*), decrement S */
-    add_action_to_queue(state, PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG);
-/*  6   A       R  fetch PCL (A = FFFE for IRQ, A = FFFA for NMI), set I flag */
-    add_action_to_queue(state, NMI_FETCH_PCL);
-/*  7   A       R  fetch PCH (A = FFFF for IRQ, A = FFFB for NMI) */
-    add_action_to_queue(state, NMI_FETCH_PCH);
+// BRK is an instruction, NMI and IRQ run interrupt_program with their vector.
+void trigger_interrupt(nes_state *state, uint16_t vector) {
+    acknowledge_interrupt(state, vector);
+    state->cpu->next_action = 0;
+    state->cpu->program = interrupt_program.actions;
+    state->cpu->program_length = interrupt_program.length;
+    state->cpu->interrupt_vector = vector;
+    state->cpu->in_interrupt = true;
 }
 
 
 void cpu_step(nes_state *state) {
-    if (state->cpu->next_action == state->cpu->end_of_queue) {
-	add_instruction_to_queue(state);
+    if (is_instruction_done(state)) {
+	start_instruction(state);
     }
+    // Polled every cycle, the poll in the last cycle of the instruction is the one that counts
+    poll_interrupt_lines(state);
     execute_next_action(state);
     state->cpu->cpu_cycle++;
-
+    // The sequence ends with PC at the handler, whose first instruction runs right after it
+    if (state->cpu->in_interrupt && is_instruction_done(state)) {
+	state->cpu->in_interrupt = false;
+	load_program(state);
+    }
 }
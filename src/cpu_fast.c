@@ -0,0 +1,513 @@
+#include <stdio.h>
+#include "cpu.h"
+#include "cpu_fast.h"
+#include "memory.h"
+#include "microcode.h"
+#include "decode_cache.h"
+#include "interrupt.h"
+
+// The fast core runs a whole instruction per call, instead of one action per cycle.
+// There is no way to stop in the middle of an instruction, so everything happens
+// as if the bus accesses were done in the first cycle. Use the cycle core (cpu_step)
+// for anything depending on mid-instruction timing.
+// The cycle count of every opcode is the length of its program in microcode.c,
+// so both cores always agree on the base timing.
+
+
+void fast_push_byte(nes_state *state, uint8_t value) {
+    write_stack(state, value);
+    state->cpu->registers->SP--;
+}
+
+uint8_t fast_pull_byte(nes_state *state) {
+    state->cpu->registers->SP++;
+    return read_stack(state);
+}
+
+static void set_nz_flags(nes_state *state, uint8_t value) {
+    state->cpu->registers->SR &= (255-128-2);
+    if (value == 0) { state->cpu->registers->SR |= 2; }
+    state->cpu->registers->SR |= value & 128;
+}
+
+static void set_flag(nes_state *state, uint8_t flag, bool value) {
+    if (value) { state->cpu->registers->SR |= flag; }
+    else { state->cpu->registers->SR &= ~flag; }
+}
+
+
+// Addressing modes. The operand bytes come from the decoded instruction, PC is already past them.
+// The indexed modes add a cycle to *cycles when a page boundary is crossed,
+// pass NULL for the instructions that always take the extra cycle.
+static uint8_t immediate(const decoded_instruction *d) {
+    return (uint8_t) d->operand;
+}
+
+static uint8_t addr_zeropage(const decoded_instruction *d) {
+    return (uint8_t) d->operand;
+}
+
+static uint8_t addr_zeropage_indexed(const decoded_instruction *d, uint8_t index) {
+    return (uint8_t) (d->operand + index);
+}
+
+static uint16_t addr_absolute(const decoded_instruction *d) {
+    return d->operand;
+}
+
+static uint16_t add_index(uint16_t base, uint8_t index, uint8_t *cycles) {
+    uint16_t addr = base + index;
+    if (cycles != NULL && (base & 0xFF00) != (addr & 0xFF00)) { (*cycles)++; }
+    return addr;
+}
+
+static uint16_t addr_absolute_indexed(const decoded_instruction *d, uint8_t index, uint8_t *cycles) {
+    return add_index(d->operand, index, cycles);
+}
+
+// (zp,X)
+static uint16_t addr_indexed_indirect(nes_state *state, const decoded_instruction *d) {
+    uint8_t pointer = d->operand + state->cpu->registers->X;
+    uint16_t low = read_zp(state, pointer);
+    return low | ((uint16_t) read_zp(state, pointer + 1) << 8);
+}
+
+// (zp),Y
+static uint16_t addr_indirect_indexed(nes_state *state, const decoded_instruction *d, uint8_t *cycles) {
+    uint8_t pointer = d->operand;
+    uint16_t low = read_zp(state, pointer);
+    uint16_t base = low | ((uint16_t) read_zp(state, pointer + 1) << 8);
+    return add_index(base, state->cpu->registers->Y, cycles);
+}
+
+
+// Operations
+void fast_adc(nes_state *state, uint8_t value) {
+    uint8_t acc = state->cpu->registers->ACC;
+    uint16_t res = (uint16_t) acc + (uint16_t) value + (state->cpu->registers->SR & 1);
+    set_flag(state, 1, res > 255);
+    set_flag(state, 64, (acc ^ (uint8_t) res) & (value ^ (uint8_t) res) & 0x80);
+    state->cpu->registers->ACC = (uint8_t) res;
+    set_nz_flags(state, (uint8_t) res);
+}
+
+// The only difference between ADC and SBC is that SBC complements its argument
+void fast_sbc(nes_state *state, uint8_t value) {
+    fast_adc(state, ~value);
+}
+
+/* http://www.6502.org/tutorials/6502opcodes.html#CMP */
+void fast_compare(nes_state *state, uint8_t reg, uint8_t value) {
+    set_flag(state, 1, reg >= value);
+    set_nz_flags(state, reg - value);
+}
+
+void fast_bit(nes_state *state, uint8_t value) {
+    set_flag(state, 2, (value & state->cpu->registers->ACC) == 0);
+    set_flag(state, 128, value & 128);
+    set_flag(state, 64, value & 64);
+}
+
+uint8_t fast_asl(nes_state *state, uint8_t value) {
+    set_flag(state, 1, value & 0x80);
+    value = value << 1;
+    set_nz_flags(state, value);
+    return value;
+}
+
+uint8_t fast_lsr(nes_state *state, uint8_t value) {
+    set_flag(state, 1, value & 0x1);
+    value = value >> 1;
+    set_nz_flags(state, value);
+    return value;
+}
+
+uint8_t fast_rol(nes_state *state, uint8_t value) {
+    uint8_t carry = state->cpu->registers->SR & 1;
+    set_flag(state, 1, value & 0x80);
+    value = (value << 1) | carry;
+    set_nz_flags(state, value);
+    return value;
+}
+
+uint8_t fast_ror(nes_state *state, uint8_t value) {
+    uint8_t carry = state->cpu->registers->SR & 1;
+    set_flag(state, 1, value & 0x1);
+    value = (value >> 1) | (carry << 7);
+    set_nz_flags(state, value);
+    return value;
+}
+
+void fast_load_acc(nes_state *state, uint8_t value) {
+    state->cpu->registers->ACC = value;
+    set_nz_flags(state, value);
+}
+
+void fast_load_x(nes_state *state, uint8_t value) {
+    state->cpu->registers->X = value;
+    set_nz_flags(state, value);
+}
+
+void fast_load_y(nes_state *state, uint8_t value) {
+    state->cpu->registers->Y = value;
+    set_nz_flags(state, value);
+}
+
+void fast_ora(nes_state *state, uint8_t value) { fast_load_acc(state, state->cpu->registers->ACC | value); }
+void fast_and(nes_state *state, uint8_t value) { fast_load_acc(state, state->cpu->registers->ACC & value); }
+void fast_eor(nes_state *state, uint8_t value) { fast_load_acc(state, state->cpu->registers->ACC ^ value); }
+
+// *LAX - load ACC and X
+void fast_lax(nes_state *state, uint8_t value) {
+    state->cpu->registers->X = value;
+    fast_load_acc(state, value);
+}
+
+// Read-modify-write instructions, including the illegal combined ones.
+// The 6502 writes the value it read back before the result. Only a handler (a board register,
+// the PPU) can tell the two writes apart, plain memory gets the result right after.
+void fast_read_modify_write(nes_state *state, uint16_t addr, uint8_t op) {
+    uint8_t value = read_mem(state, addr);
+    if (state->map.write[addr >> 8] == NULL) {
+	write_mem(state, addr, value);
+    }
+    switch (op) {
+    case RMW_ASL: value = fast_asl(state, value); break;
+    case RMW_LSR: value = fast_lsr(state, value); break;
+    case RMW_ROL: value = fast_rol(state, value); break;
+    case RMW_ROR: value = fast_ror(state, value); break;
+    case RMW_INC: value++; set_nz_flags(state, value); break;
+    case RMW_DEC: value--; set_nz_flags(state, value); break;
+    case RMW_SLO: value = fast_asl(state, value); fast_ora(state, value); break;
+    case RMW_RLA: value = fast_rol(state, value); fast_and(state, value); break;
+    case RMW_SRE: value = fast_lsr(state, value); fast_eor(state, value); break;
+    case RMW_RRA: value = fast_ror(state, value); fast_adc(state, value); break;
+    case RMW_DCP: value--; fast_compare(state, state->cpu->registers->ACC, value); break;
+    case RMW_ISB: value++; fast_sbc(state, value); break;
+    }
+    write_mem(state, addr, value);
+}
+
+// Conditional branch. Adds a cycle when taken and another one when crossing a page.
+static void branch(nes_state *state, const decoded_instruction *d, bool taken, uint8_t *cycles) {
+    int8_t displacement = (int8_t) d->operand;
+    if (!taken) { return; }
+    (*cycles)++;
+    uint16_t old_pc = state->cpu->registers->PC;
+    state->cpu->registers->PC += displacement;
+    if ((old_pc & 0xFF00) != (state->cpu->registers->PC & 0xFF00)) { (*cycles)++; }
+}
+
+static uint16_t read_vector(nes_state *state, uint16_t addr) {
+    uint16_t low = read_mem(state, addr);
+    return low | ((uint16_t) read_mem(state, addr + 1) << 8);
+}
+
+// NMI or IRQ, same sequence as interrupt_program in microcode.c
+static void interrupt(nes_state *state, uint16_t vector) {
+    acknowledge_interrupt(state, vector);
+    fast_push_byte(state, state->cpu->registers->PC >> 8);
+    fast_push_byte(state, state->cpu->registers->PC & 0xFF);
+    fast_push_byte(state, 32 | state->cpu->registers->SR);
+    set_interrupt_flag(state);
+    state->cpu->registers->PC = read_vector(state, vector);
+}
+
+
+uint16_t cpu_fast_step(nes_state *state) {
+    registers *regs = state->cpu->registers;
+    uint8_t cycles = 0;
+    // Polled at the end of the last instruction, see poll_interrupt_lines
+    if (state->cpu->polled_interrupt != 0) {
+	interrupt(state, state->cpu->polled_interrupt);
+	state->cpu->polled_interrupt = 0;
+	cycles += interrupt_program.length;
+    }
+    const decoded_instruction *d = decode_instruction(state, regs->PC);
+    uint8_t opcode = d->opcode;
+    state->cpu->current_opcode = opcode;
+    // Unknown opcodes stop after fetching the opcode
+    regs->PC += d->program != NULL ? d->size : 1;
+    // Branches are one shorter when not taken, branch() adds the cycle back
+    cycles += d->cycles;
+
+    switch (opcode) {
+	// BRK
+    case 0x00:
+	regs->PC++;
+	fast_push_byte(state, regs->PC >> 8);
+	fast_push_byte(state, regs->PC & 0xFF);
+	/* https://wiki.nesdev.com/w/index.php/Status_flags#The_B_flag */
+	fast_push_byte(state, 48 | regs->SR);
+	regs->PC = read_vector(state, 0xFFFE);
+	break;
+
+	// ORA
+    case 0x09: fast_ora(state, immediate(d)); break;
+    case 0x05: fast_ora(state, read_zp(state, addr_zeropage(d))); break;
+    case 0x15: fast_ora(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0x0D: fast_ora(state, read_mem(state, addr_absolute(d))); break;
+    case 0x1D: fast_ora(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0x19: fast_ora(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0x01: fast_ora(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0x11: fast_ora(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// AND
+    case 0x29: fast_and(state, immediate(d)); break;
+    case 0x25: fast_and(state, read_zp(state, addr_zeropage(d))); break;
+    case 0x35: fast_and(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0x2D: fast_and(state, read_mem(state, addr_absolute(d))); break;
+    case 0x3D: fast_and(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0x39: fast_and(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0x21: fast_and(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0x31: fast_and(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// EOR
+    case 0x49: fast_eor(state, immediate(d)); break;
+    case 0x45: fast_eor(state, read_zp(state, addr_zeropage(d))); break;
+    case 0x55: fast_eor(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0x4D: fast_eor(state, read_mem(state, addr_absolute(d))); break;
+    case 0x5D: fast_eor(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0x59: fast_eor(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0x41: fast_eor(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0x51: fast_eor(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// ADC
+    case 0x69: fast_adc(state, immediate(d)); break;
+    case 0x65: fast_adc(state, read_zp(state, addr_zeropage(d))); break;
+    case 0x75: fast_adc(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0x6D: fast_adc(state, read_mem(state, addr_absolute(d))); break;
+    case 0x7D: fast_adc(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0x79: fast_adc(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0x61: fast_adc(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0x71: fast_adc(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// SBC (and the illegal *SBC immediate at 0xEB)
+    case 0xE9:
+    case 0xEB: fast_sbc(state, immediate(d)); break;
+    case 0xE5: fast_sbc(state, read_zp(state, addr_zeropage(d))); break;
+    case 0xF5: fast_sbc(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0xED: fast_sbc(state, read_mem(state, addr_absolute(d))); break;
+    case 0xFD: fast_sbc(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0xF9: fast_sbc(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0xE1: fast_sbc(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0xF1: fast_sbc(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// CMP
+    case 0xC9: fast_compare(state, regs->ACC, immediate(d)); break;
+    case 0xC5: fast_compare(state, regs->ACC, read_zp(state, addr_zeropage(d))); break;
+    case 0xD5: fast_compare(state, regs->ACC, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0xCD: fast_compare(state, regs->ACC, read_mem(state, addr_absolute(d))); break;
+    case 0xDD: fast_compare(state, regs->ACC, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0xD9: fast_compare(state, regs->ACC, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0xC1: fast_compare(state, regs->ACC, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0xD1: fast_compare(state, regs->ACC, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// CPX and CPY
+    case 0xE0: fast_compare(state, regs->X, immediate(d)); break;
+    case 0xE4: fast_compare(state, regs->X, read_zp(state, addr_zeropage(d))); break;
+    case 0xEC: fast_compare(state, regs->X, read_mem(state, addr_absolute(d))); break;
+    case 0xC0: fast_compare(state, regs->Y, immediate(d)); break;
+    case 0xC4: fast_compare(state, regs->Y, read_zp(state, addr_zeropage(d))); break;
+    case 0xCC: fast_compare(state, regs->Y, read_mem(state, addr_absolute(d))); break;
+
+	// BIT
+    case 0x24: fast_bit(state, read_zp(state, addr_zeropage(d))); break;
+    case 0x2C: fast_bit(state, read_mem(state, addr_absolute(d))); break;
+
+	// LDA
+    case 0xA9: fast_load_acc(state, immediate(d)); break;
+    case 0xA5: fast_load_acc(state, read_zp(state, addr_zeropage(d))); break;
+    case 0xB5: fast_load_acc(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0xAD: fast_load_acc(state, read_mem(state, addr_absolute(d))); break;
+    case 0xBD: fast_load_acc(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+    case 0xB9: fast_load_acc(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0xA1: fast_load_acc(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0xB1: fast_load_acc(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// LDX
+    case 0xA2: fast_load_x(state, immediate(d)); break;
+    case 0xA6: fast_load_x(state, read_zp(state, addr_zeropage(d))); break;
+    case 0xB6: fast_load_x(state, read_zp(state, addr_zeropage_indexed(d, regs->Y))); break;
+    case 0xAE: fast_load_x(state, read_mem(state, addr_absolute(d))); break;
+    case 0xBE: fast_load_x(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+
+	// LDY
+    case 0xA0: fast_load_y(state, immediate(d)); break;
+    case 0xA4: fast_load_y(state, read_zp(state, addr_zeropage(d))); break;
+    case 0xB4: fast_load_y(state, read_zp(state, addr_zeropage_indexed(d, regs->X))); break;
+    case 0xAC: fast_load_y(state, read_mem(state, addr_absolute(d))); break;
+    case 0xBC: fast_load_y(state, read_mem(state, addr_absolute_indexed(d, regs->X, &cycles))); break;
+
+	// *LAX - Illegal instruction
+    case 0xA7: fast_lax(state, read_zp(state, addr_zeropage(d))); break;
+    case 0xB7: fast_lax(state, read_zp(state, addr_zeropage_indexed(d, regs->Y))); break;
+    case 0xAF: fast_lax(state, read_mem(state, addr_absolute(d))); break;
+    case 0xBF: fast_lax(state, read_mem(state, addr_absolute_indexed(d, regs->Y, &cycles))); break;
+    case 0xA3: fast_lax(state, read_mem(state, addr_indexed_indirect(state, d))); break;
+    case 0xB3: fast_lax(state, read_mem(state, addr_indirect_indexed(state, d, &cycles))); break;
+
+	// STA
+    case 0x85: write_zp(state, addr_zeropage(d), regs->ACC); break;
+    case 0x95: write_zp(state, addr_zeropage_indexed(d, regs->X), regs->ACC); break;
+    case 0x8D: write_mem(state, addr_absolute(d), regs->ACC); break;
+    case 0x9D: write_mem(state, addr_absolute_indexed(d, regs->X, NULL), regs->ACC); break;
+    case 0x99: write_mem(state, addr_absolute_indexed(d, regs->Y, NULL), regs->ACC); break;
+    case 0x81: write_mem(state, addr_indexed_indirect(state, d), regs->ACC); break;
+    case 0x91: write_mem(state, addr_indirect_indexed(state, d, NULL), regs->ACC); break;
+
+	// STX, STY
+    case 0x86: write_zp(state, addr_zeropage(d), regs->X); break;
+    case 0x96: write_zp(state, addr_zeropage_indexed(d, regs->Y), regs->X); break;
+    case 0x8E: write_mem(state, addr_absolute(d), regs->X); break;
+    case 0x84: write_zp(state, addr_zeropage(d), regs->Y); break;
+    case 0x94: write_zp(state, addr_zeropage_indexed(d, regs->X), regs->Y); break;
+    case 0x8C: write_mem(state, addr_absolute(d), regs->Y); break;
+
+	// *SAX - Illegal instruction
+    case 0x87: write_zp(state, addr_zeropage(d), regs->ACC & regs->X); break;
+    case 0x97: write_zp(state, addr_zeropage_indexed(d, regs->Y), regs->ACC & regs->X); break;
+    case 0x8F: write_mem(state, addr_absolute(d), regs->ACC & regs->X); break;
+    case 0x83: write_mem(state, addr_indexed_indirect(state, d), regs->ACC & regs->X); break;
+
+	// Shifts and rotates on the accumulator
+    case 0x0A: regs->ACC = fast_asl(state, regs->ACC); break;
+    case 0x4A: regs->ACC = fast_lsr(state, regs->ACC); break;
+    case 0x2A: regs->ACC = fast_rol(state, regs->ACC); break;
+    case 0x6A: regs->ACC = fast_ror(state, regs->ACC); break;
+
+	// Read-modify-write, official and illegal. The low 5 bits of the opcode pick the addressing mode.
+    case 0x06: case 0x46: case 0x26: case 0x66: case 0xE6: case 0xC6:
+    case 0x07: case 0x27: case 0x47: case 0x67: case 0xC7: case 0xE7:
+    case 0x16: case 0x56: case 0x36: case 0x76: case 0xF6: case 0xD6:
+    case 0x17: case 0x37: case 0x57: case 0x77: case 0xD7: case 0xF7:
+    case 0x0E: case 0x4E: case 0x2E: case 0x6E: case 0xEE: case 0xCE:
+    case 0x0F: case 0x2F: case 0x4F: case 0x6F: case 0xCF: case 0xEF:
+    case 0x1E: case 0x5E: case 0x3E: case 0x7E: case 0xFE: case 0xDE:
+    case 0x1F: case 0x3F: case 0x5F: case 0x7F: case 0xDF: case 0xFF:
+    case 0x1B: case 0x3B: case 0x5B: case 0x7B: case 0xDB: case 0xFB:
+    case 0x03: case 0x23: case 0x43: case 0x63: case 0xC3: case 0xE3:
+    case 0x13: case 0x33: case 0x53: case 0x73: case 0xD3: case 0xF3:
+    {
+	static const uint8_t ops[8][2] = {
+	    { RMW_ASL, RMW_SLO }, { RMW_ROL, RMW_RLA }, { RMW_LSR, RMW_SRE }, { RMW_ROR, RMW_RRA },
+	    { 0, 0 }, { 0, 0 }, { RMW_DEC, RMW_DCP }, { RMW_INC, RMW_ISB } };
+	uint8_t op = ops[opcode >> 5][opcode & 1];
+	uint16_t addr = 0;
+	switch (opcode & 0x1E) {
+	case 0x06: addr = addr_zeropage(d); break;
+	case 0x16: addr = addr_zeropage_indexed(d, regs->X); break;
+	case 0x0E: addr = addr_absolute(d); break;
+	case 0x1E: addr = addr_absolute_indexed(d, regs->X, NULL); break;
+	case 0x1A: addr = addr_absolute_indexed(d, regs->Y, NULL); break;
+	case 0x02: addr = addr_indexed_indirect(state, d); break;
+	case 0x12: addr = addr_indirect_indexed(state, d, NULL); break;
+	}
+	fast_read_modify_write(state, addr, op);
+    }
+    break;
+
+	// Register increments, decrements and transfers
+    case 0xE8: fast_load_x(state, regs->X + 1); break;
+    case 0xC8: fast_load_y(state, regs->Y + 1); break;
+    case 0xCA: fast_load_x(state, regs->X - 1); break;
+    case 0x88: fast_load_y(state, regs->Y - 1); break;
+    case 0xAA: fast_load_x(state, regs->ACC); break;
+    case 0xA8: fast_load_y(state, regs->ACC); break;
+    case 0x8A: fast_load_acc(state, regs->X); break;
+    case 0x98: fast_load_acc(state, regs->Y); break;
+    case 0xBA: fast_load_x(state, regs->SP); break;
+    case 0x9A: regs->SP = regs->X; break;
+
+	// Stack
+    case 0x48: fast_push_byte(state, regs->ACC); break;
+    case 0x68: fast_load_acc(state, fast_pull_byte(state)); break;
+	/* https://wiki.nesdev.com/w/index.php/Status_flags#The_B_flag */
+    case 0x08: fast_push_byte(state, 48 | regs->SR); break;
+	// PLP ignores bits 4 and 5
+    case 0x28: regs->SR = (fast_pull_byte(state) & 0xcf) | (regs->SR & 0x30); break;
+
+	// Jumps and subroutines
+    case 0x4C: regs->PC = addr_absolute(d); break;
+	// JMP indirect never crosses a page when fetching the high byte
+    case 0x6C:
+    {
+	uint16_t pointer = addr_absolute(d);
+	uint16_t low = read_mem(state, pointer);
+	uint16_t high = read_mem(state, (pointer & 0xFF00) | ((pointer + 1) & 0xFF));
+	regs->PC = low | (high << 8);
+    }
+    break;
+    case 0x20:
+    {
+	// The pushed address is the last byte of the JSR
+	uint16_t return_addr = regs->PC - 1;
+	fast_push_byte(state, return_addr >> 8);
+	fast_push_byte(state, return_addr & 0xFF);
+	regs->PC = addr_absolute(d);
+    }
+    break;
+    case 0x60:
+    {
+	uint16_t low = fast_pull_byte(state);
+	regs->PC = (low | ((uint16_t) fast_pull_byte(state) << 8)) + 1;
+    }
+    break;
+    case 0x40:
+    {
+	regs->SR = (fast_pull_byte(state) & 0xcf) | (regs->SR & 0x30);
+	uint16_t low = fast_pull_byte(state);
+	regs->PC = low | ((uint16_t) fast_pull_byte(state) << 8);
+    }
+    break;
+
+	// Branches
+    case 0x10: branch(state, d, !is_negative_flag_set(state), &cycles); break;
+	// Same condition as the BMI program in microcode.c
+    case 0x30: branch(state, d, !is_zero_flag_set(state) && is_negative_flag_set(state), &cycles); break;
+    case 0x50: branch(state, d, !is_overflow_flag_set(state), &cycles); break;
+    case 0x70: branch(state, d, is_overflow_flag_set(state), &cycles); break;
+    case 0x90: branch(state, d, !is_carry_flag_set(state), &cycles); break;
+    case 0xB0: branch(state, d, is_carry_flag_set(state), &cycles); break;
+    case 0xD0: branch(state, d, !is_zero_flag_set(state), &cycles); break;
+    case 0xF0: branch(state, d, is_zero_flag_set(state), &cycles); break;
+
+	// Flags
+    case 0x18: clear_carry_flag(state); break;
+    case 0x38: set_carry_flag(state); break;
+    case 0x78: set_interrupt_flag(state); break;
+    case 0xB8: clear_overflow_flag(state); break;
+    case 0xD8: clear_decimal_flag(state); break;
+    case 0xF8: set_decimal_flag(state); break;
+
+	// NOP and the illegal *NOPs
+    case 0xEA:
+    case 0x1A: case 0x3A: case 0x5A: case 0x7A: case 0xDA: case 0xFA:
+	break;
+    case 0x80: case 0x82: case 0x89: case 0xC2: case 0xE2:
+    case 0x04: case 0x44: case 0x64:
+    case 0x14: case 0x34: case 0x54: case 0x74: case 0xD4: case 0xF4:
+    case 0x0C:
+	break;
+    case 0x1C: case 0x3C: case 0x5C: case 0x7C: case 0xDC: case 0xFC:
+	addr_absolute_indexed(d, regs->X, &cycles);
+	break;
+
+	// Not implemented (same opcodes as in the cycle core)
+    default:
+	state->fatal_error = true;
+	state->running = false;
+	break;
+    }
+
+    state->cpu->cpu_cycle += cycles;
+    // An OAM DMA halts the cpu after the instruction
+    if (state->cpu->stall_cycles != 0) {
+	if (state->cpu->oam_dma_align) { align_oam_dma(state); }
+	uint16_t stall = state->cpu->stall_cycles;
+	state->cpu->stall_cycles = 0;
+	state->cpu->cpu_cycle += stall;
+	return cycles + stall;
+    }
+    return cycles;
+}
@@ -0,0 +1,529 @@
+#include <stdlib.h>
+#include "cpu.h"
+#include "cpu_fast.h"
+#include "cpu_multi.h"
+#include "decode_cache.h"
+#include "mapper.h"
+#include "memory.h"
+#include "microcode.h"
+
+// The multi-instance engine runs many copies of the same rom, which mostly run the same code.
+// All lanes at the same PC run the instruction together: it is decoded once, and the registers,
+// flags and RAM of every lane are computed with vector operations, masked to those lanes.
+// The lane furthest behind in cycles picks the PC, so the lanes stay close in time,
+// and lanes that branched differently join again when they reach the same PC.
+// With a mapper the lanes can have different banks at the same PC, only lanes with the same
+// part of PRG-ROM mapped there run together.
+// Instructions that are not handled here (io accesses, RTI, BRK, JMP indirect, code in RAM)
+// run on the fast core, one lane at a time, with its state copied in and out.
+// The results are the same as running each copy with cpu_fast_step.
+
+
+enum MULTI_KIND { M_NONE, M_READ, M_WRITE, M_MODIFY, M_IMPLIED, M_JMP, M_JSR, M_RTS, M_BRANCH };
+
+enum MULTI_OP {
+    OP_NONE,
+    // Read
+    OP_ORA, OP_AND, OP_EOR, OP_ADC, OP_SBC, OP_CMP, OP_CPX, OP_CPY, OP_BIT,
+    OP_LDA, OP_LDX, OP_LDY, OP_LAX, OP_NOP,
+    // Write
+    OP_STA, OP_STX, OP_STY, OP_SAX,
+    // Modify, also on the accumulator
+    OP_ASL, OP_LSR, OP_ROL, OP_ROR, OP_INC, OP_DEC,
+    // Implied
+    OP_INX, OP_INY, OP_DEX, OP_DEY, OP_TAX, OP_TAY, OP_TXA, OP_TYA, OP_TSX, OP_TXS,
+    OP_PHA, OP_PLA, OP_PHP, OP_PLP, OP_SET_FLAG, OP_CLEAR_FLAG
+};
+
+// How to run every opcode. The illegal read-modify-write opcodes modify with op,
+// and then read the new value with then (e.g. *SLO is ASL and ORA).
+// For the flag instructions flag is the bit.
+typedef struct MULTI_OPCODE {
+    uint8_t kind; // enum MULTI_KIND
+    uint8_t op; // enum MULTI_OP
+    uint8_t then; // enum MULTI_OP
+    uint8_t flag;
+} multi_opcode;
+
+#define R(o) { M_READ, o, OP_NONE, 0 }
+#define W(o) { M_WRITE, o, OP_NONE, 0 }
+#define M(o, t) { M_MODIFY, o, t, 0 }
+#define I(o) { M_IMPLIED, o, OP_NONE, 0 }
+#define FLAG(o, f) { M_IMPLIED, o, OP_NONE, f }
+
+static const multi_opcode opcodes[256] = {
+    [0x09] = R(OP_ORA), [0x05] = R(OP_ORA), [0x15] = R(OP_ORA), [0x0D] = R(OP_ORA),
+    [0x1D] = R(OP_ORA), [0x19] = R(OP_ORA), [0x01] = R(OP_ORA), [0x11] = R(OP_ORA),
+    [0x29] = R(OP_AND), [0x25] = R(OP_AND), [0x35] = R(OP_AND), [0x2D] = R(OP_AND),
+    [0x3D] = R(OP_AND), [0x39] = R(OP_AND), [0x21] = R(OP_AND), [0x31] = R(OP_AND),
+    [0x49] = R(OP_EOR), [0x45] = R(OP_EOR), [0x55] = R(OP_EOR), [0x4D] = R(OP_EOR),
+    [0x5D] = R(OP_EOR), [0x59] = R(OP_EOR), [0x41] = R(OP_EOR), [0x51] = R(OP_EOR),
+    [0x69] = R(OP_ADC), [0x65] = R(OP_ADC), [0x75] = R(OP_ADC), [0x6D] = R(OP_ADC),
+    [0x7D] = R(OP_ADC), [0x79] = R(OP_ADC), [0x61] = R(OP_ADC), [0x71] = R(OP_ADC),
+    [0xE9] = R(OP_SBC), [0xEB] = R(OP_SBC), [0xE5] = R(OP_SBC), [0xF5] = R(OP_SBC), [0xED] = R(OP_SBC),
+    [0xFD] = R(OP_SBC), [0xF9] = R(OP_SBC), [0xE1] = R(OP_SBC), [0xF1] = R(OP_SBC),
+    [0xC9] = R(OP_CMP), [0xC5] = R(OP_CMP), [0xD5] = R(OP_CMP), [0xCD] = R(OP_CMP),
+    [0xDD] = R(OP_CMP), [0xD9] = R(OP_CMP), [0xC1] = R(OP_CMP), [0xD1] = R(OP_CMP),
+    [0xE0] = R(OP_CPX), [0xE4] = R(OP_CPX), [0xEC] = R(OP_CPX),
+    [0xC0] = R(OP_CPY), [0xC4] = R(OP_CPY), [0xCC] = R(OP_CPY),
+    [0x24] = R(OP_BIT), [0x2C] = R(OP_BIT),
+    [0xA9] = R(OP_LDA), [0xA5] = R(OP_LDA), [0xB5] = R(OP_LDA), [0xAD] = R(OP_LDA),
+    [0xBD] = R(OP_LDA), [0xB9] = R(OP_LDA), [0xA1] = R(OP_LDA), [0xB1] = R(OP_LDA),
+    [0xA2] = R(OP_LDX), [0xA6] = R(OP_LDX), [0xB6] = R(OP_LDX), [0xAE] = R(OP_LDX), [0xBE] = R(OP_LDX),
+    [0xA0] = R(OP_LDY), [0xA4] = R(OP_LDY), [0xB4] = R(OP_LDY), [0xAC] = R(OP_LDY), [0xBC] = R(OP_LDY),
+    [0xA7] = R(OP_LAX), [0xB7] = R(OP_LAX), [0xAF] = R(OP_LAX), [0xBF] = R(OP_LAX),
+    [0xA3] = R(OP_LAX), [0xB3] = R(OP_LAX),
+    // The *NOPs with operands don't read, see cpu_fast_step
+    [0x80] = R(OP_NOP), [0x82] = R(OP_NOP), [0x89] = R(OP_NOP), [0xC2] = R(OP_NOP), [0xE2] = R(OP_NOP),
+    [0x04] = R(OP_NOP), [0x44] = R(OP_NOP), [0x64] = R(OP_NOP), [0x0C] = R(OP_NOP),
+    [0x14] = R(OP_NOP), [0x34] = R(OP_NOP), [0x54] = R(OP_NOP), [0x74] = R(OP_NOP),
+    [0xD4] = R(OP_NOP), [0xF4] = R(OP_NOP),
+    [0x1C] = R(OP_NOP), [0x3C] = R(OP_NOP), [0x5C] = R(OP_NOP),
+    [0x7C] = R(OP_NOP), [0xDC] = R(OP_NOP), [0xFC] = R(OP_NOP),
+
+    [0x85] = W(OP_STA), [0x95] = W(OP_STA), [0x8D] = W(OP_STA), [0x9D] = W(OP_STA),
+    [0x99] = W(OP_STA), [0x81] = W(OP_STA), [0x91] = W(OP_STA),
+    [0x86] = W(OP_STX), [0x96] = W(OP_STX), [0x8E] = W(OP_STX),
+    [0x84] = W(OP_STY), [0x94] = W(OP_STY), [0x8C] = W(OP_STY),
+    [0x87] = W(OP_SAX), [0x97] = W(OP_SAX), [0x8F] = W(OP_SAX), [0x83] = W(OP_SAX),
+
+    [0x0A] = M(OP_ASL, OP_NONE), [0x06] = M(OP_ASL, OP_NONE), [0x16] = M(OP_ASL, OP_NONE),
+    [0x0E] = M(OP_ASL, OP_NONE), [0x1E] = M(OP_ASL, OP_NONE),
+    [0x4A] = M(OP_LSR, OP_NONE), [0x46] = M(OP_LSR, OP_NONE), [0x56] = M(OP_LSR, OP_NONE),
+    [0x4E] = M(OP_LSR, OP_NONE), [0x5E] = M(OP_LSR, OP_NONE),
+    [0x2A] = M(OP_ROL, OP_NONE), [0x26] = M(OP_ROL, OP_NONE), [0x36] = M(OP_ROL, OP_NONE),
+    [0x2E] = M(OP_ROL, OP_NONE), [0x3E] = M(OP_ROL, OP_NONE),
+    [0x6A] = M(OP_ROR, OP_NONE), [0x66] = M(OP_ROR, OP_NONE), [0x76] = M(OP_ROR, OP_NONE),
+    [0x6E] = M(OP_ROR, OP_NONE), [0x7E] = M(OP_ROR, OP_NONE),
+    [0xE6] = M(OP_INC, OP_NONE), [0xF6] = M(OP_INC, OP_NONE), [0xEE] = M(OP_INC, OP_NONE), [0xFE] = M(OP_INC, OP_NONE),
+    [0xC6] = M(OP_DEC, OP_NONE), [0xD6] = M(OP_DEC, OP_NONE), [0xCE] = M(OP_DEC, OP_NONE), [0xDE] = M(OP_DEC, OP_NONE),
+    [0x07] = M(OP_ASL, OP_ORA), [0x17] = M(OP_ASL, OP_ORA), [0x0F] = M(OP_ASL, OP_ORA), [0x1F] = M(OP_ASL, OP_ORA),
+    [0x1B] = M(OP_ASL, OP_ORA), [0x03] = M(OP_ASL, OP_ORA), [0x13] = M(OP_ASL, OP_ORA),
+    [0x27] = M(OP_ROL, OP_AND), [0x37] = M(OP_ROL, OP_AND), [0x2F] = M(OP_ROL, OP_AND), [0x3F] = M(OP_ROL, OP_AND),
+    [0x3B] = M(OP_ROL, OP_AND), [0x23] = M(OP_ROL, OP_AND), [0x33] = M(OP_ROL, OP_AND),
+    [0x47] = M(OP_LSR, OP_EOR), [0x57] = M(OP_LSR, OP_EOR), [0x4F] = M(OP_LSR, OP_EOR), [0x5F] = M(OP_LSR, OP_EOR),
+    [0x5B] = M(OP_LSR, OP_EOR), [0x43] = M(OP_LSR, OP_EOR), [0x53] = M(OP_LSR, OP_EOR),
+    [0x67] = M(OP_ROR, OP_ADC), [0x77] = M(OP_ROR, OP_ADC), [0x6F] = M(OP_ROR, OP_ADC), [0x7F] = M(OP_ROR, OP_ADC),
+    [0x7B] = M(OP_ROR, OP_ADC), [0x63] = M(OP_ROR, OP_ADC), [0x73] = M(OP_ROR, OP_ADC),
+    [0xC7] = M(OP_DEC, OP_CMP), [0xD7] = M(OP_DEC, OP_CMP), [0xCF] = M(OP_DEC, OP_CMP), [0xDF] = M(OP_DEC, OP_CMP),
+    [0xDB] = M(OP_DEC, OP_CMP), [0xC3] = M(OP_DEC, OP_CMP), [0xD3] = M(OP_DEC, OP_CMP),
+    [0xE7] = M(OP_INC, OP_SBC), [0xF7] = M(OP_INC, OP_SBC), [0xEF] = M(OP_INC, OP_SBC), [0xFF] = M(OP_INC, OP_SBC),
+    [0xFB] = M(OP_INC, OP_SBC), [0xE3] = M(OP_INC, OP_SBC), [0xF3] = M(OP_INC, OP_SBC),
+
+    [0xE8] = I(OP_INX), [0xC8] = I(OP_INY), [0xCA] = I(OP_DEX), [0x88] = I(OP_DEY),
+    [0xAA] = I(OP_TAX), [0xA8] = I(OP_TAY), [0x8A] = I(OP_TXA), [0x98] = I(OP_TYA),
+    [0xBA] = I(OP_TSX), [0x9A] = I(OP_TXS),
+    [0x48] = I(OP_PHA), [0x68] = I(OP_PLA), [0x08] = I(OP_PHP), [0x28] = I(OP_PLP),
+    [0x18] = FLAG(OP_CLEAR_FLAG, 1), [0x38] = FLAG(OP_SET_FLAG, 1), [0x78] = FLAG(OP_SET_FLAG, 4),
+    [0xB8] = FLAG(OP_CLEAR_FLAG, 64), [0xD8] = FLAG(OP_CLEAR_FLAG, 8), [0xF8] = FLAG(OP_SET_FLAG, 8),
+    [0xEA] = I(OP_NONE), [0x1A] = I(OP_NONE), [0x3A] = I(OP_NONE), [0x5A] = I(OP_NONE),
+    [0x7A] = I(OP_NONE), [0xDA] = I(OP_NONE), [0xFA] = I(OP_NONE),
+
+    [0x4C] = { M_JMP, OP_NONE, OP_NONE, 0 },
+    [0x20] = { M_JSR, OP_NONE, OP_NONE, 0 },
+    [0x60] = { M_RTS, OP_NONE, OP_NONE, 0 },
+    [0x10] = { M_BRANCH, OP_NONE, OP_NONE, 0 }, [0x30] = { M_BRANCH, OP_NONE, OP_NONE, 0 },
+    [0x50] = { M_BRANCH, OP_NONE, OP_NONE, 0 }, [0x70] = { M_BRANCH, OP_NONE, OP_NONE, 0 },
+    [0x90] = { M_BRANCH, OP_NONE, OP_NONE, 0 }, [0xB0] = { M_BRANCH, OP_NONE, OP_NONE, 0 },
+    [0xD0] = { M_BRANCH, OP_NONE, OP_NONE, 0 }, [0xF0] = { M_BRANCH, OP_NONE, OP_NONE, 0 },
+};
+
+
+// The lanes an instruction runs for: a mask (0xFF in the lanes, 0 elsewhere) and a list
+typedef struct LANE_SET {
+    lane_bytes mask;
+    uint8_t lane[MULTI_LANES];
+    uint8_t count;
+} lane_set;
+
+static inline lane_bytes select_lanes(lane_bytes mask, lane_bytes a, lane_bytes b) {
+    return (a & mask) | (b & ~mask);
+}
+
+static inline lane_bytes nz_flags(lane_bytes value) {
+    return (value & 128) | ((lane_bytes) (value == 0) & 2);
+}
+
+// Set the flags in bits of sr from flags, in the lanes of the set
+static inline void set_flags(multi_state *m, const lane_set *set, uint8_t bits, lane_bytes flags) {
+    m->sr = select_lanes(set->mask, (m->sr & (uint8_t) ~bits) | (flags & bits), m->sr);
+}
+
+static inline void load_nz(multi_state *m, const lane_set *set, lane_bytes *reg, lane_bytes value) {
+    *reg = select_lanes(set->mask, value, *reg);
+    set_flags(m, set, 128 | 2, nz_flags(value));
+}
+
+// Carry of a + b + carry_in, from the 8 bit sum
+static inline lane_bytes carry_out(lane_bytes a, lane_bytes sum, lane_bytes carry_in) {
+    return (lane_bytes) (sum < a) | ((lane_bytes) (sum == a) & (lane_bytes) (carry_in != 0));
+}
+
+static void adc(multi_state *m, const lane_set *set, lane_bytes value) {
+    lane_bytes carry_in = m->sr & 1;
+    lane_bytes sum = m->acc + value + carry_in;
+    lane_bytes flags = (carry_out(m->acc, sum, carry_in) & 1)
+        | (((m->acc ^ sum) & (value ^ sum) & 128) >> 1) | nz_flags(sum);
+    m->acc = select_lanes(set->mask, sum, m->acc);
+    set_flags(m, set, 128 | 64 | 2 | 1, flags);
+}
+
+static void compare(multi_state *m, const lane_set *set, lane_bytes reg, lane_bytes value) {
+    set_flags(m, set, 128 | 2 | 1, ((lane_bytes) (reg >= value) & 1) | nz_flags(reg - value));
+}
+
+static void read_op(multi_state *m, const lane_set *set, uint8_t op, lane_bytes value) {
+    switch (op) {
+    case OP_ORA: load_nz(m, set, &m->acc, m->acc | value); break;
+    case OP_AND: load_nz(m, set, &m->acc, m->acc & value); break;
+    case OP_EOR: load_nz(m, set, &m->acc, m->acc ^ value); break;
+    case OP_ADC: adc(m, set, value); break;
+    case OP_SBC: adc(m, set, ~value); break;
+    case OP_CMP: compare(m, set, m->acc, value); break;
+    case OP_CPX: compare(m, set, m->x, value); break;
+    case OP_CPY: compare(m, set, m->y, value); break;
+    case OP_BIT: set_flags(m, set, 128 | 64 | 2, (value & (128 | 64)) | ((lane_bytes) ((value & m->acc) == 0) & 2)); break;
+    case OP_LDA: load_nz(m, set, &m->acc, value); break;
+    case OP_LDX: load_nz(m, set, &m->x, value); break;
+    case OP_LDY: load_nz(m, set, &m->y, value); break;
+    case OP_LAX: m->x = select_lanes(set->mask, value, m->x); load_nz(m, set, &m->acc, value); break;
+    }
+}
+
+static lane_bytes modify_op(multi_state *m, const lane_set *set, uint8_t op, lane_bytes value) {
+    lane_bytes carry_in = m->sr & 1;
+    lane_bytes result = value;
+    lane_bytes carry = { 0 };
+    switch (op) {
+    case OP_ASL: carry = value >> 7; result = value << 1; break;
+    case OP_LSR: carry = value & 1; result = value >> 1; break;
+    case OP_ROL: carry = value >> 7; result = (value << 1) | carry_in; break;
+    case OP_ROR: carry = value & 1; result = (value >> 1) | (carry_in << 7); break;
+    case OP_INC: result = value + 1; break;
+    case OP_DEC: result = value - 1; break;
+    }
+    if (op == OP_INC || op == OP_DEC) { set_flags(m, set, 128 | 2, nz_flags(result)); }
+    else { set_flags(m, set, 128 | 2 | 1, nz_flags(result) | carry); }
+    return result;
+}
+
+
+// Memory
+
+static inline bool is_ram(uint32_t addr) {
+    return addr < 0x2000;
+}
+
+// Where in PRG-ROM the page of addr ($8000-$FFFF) is mapped for a lane. Every lane has its own
+// copy of the rom, so the offsets are compared and not the host pointers.
+static inline intptr_t rom_offset(multi_state *m, uint8_t lane, uint16_t addr) {
+    nes_state *state = m->lanes[lane];
+    return state->map.read[addr >> 8] - state->rom->prg_rom;
+}
+
+// True if the lanes of the set have the same bank mapped at addr
+static bool same_bank(multi_state *m, const lane_set *set, uint16_t addr) {
+    intptr_t offset = rom_offset(m, set->lane[0], addr);
+    for (uint8_t i = 1; i < set->count; i++) {
+        if (rom_offset(m, set->lane[i], addr) != offset) { return false; }
+    }
+    return true;
+}
+
+// The address of the operand in every lane of the set, and the extra cycle for an indexed
+// address crossing a page if penalty is set. Returns false if any of them is not RAM (or ROM, for reads).
+static bool lane_addresses(multi_state *m, const decoded_instruction *d, const lane_set *set,
+                           bool write, bool penalty, uint16_t addr[], uint8_t cycles[]) {
+    uint16_t op = d->operand;
+    for (uint8_t i = 0; i < set->count; i++) {
+        uint8_t l = set->lane[i];
+        uint16_t base = op;
+        switch (d->mode) {
+        case MODE_ZEROPAGE: addr[l] = (uint8_t) op; break;
+        case MODE_ZEROPAGE_X: addr[l] = (uint8_t) (op + m->x[l]); break;
+        case MODE_ZEROPAGE_Y: addr[l] = (uint8_t) (op + m->y[l]); break;
+        case MODE_ABSOLUTE: addr[l] = op; break;
+        case MODE_ABSOLUTE_X: addr[l] = op + m->x[l]; break;
+        case MODE_ABSOLUTE_Y: addr[l] = op + m->y[l]; break;
+        case MODE_INDEXED_INDIRECT: {
+            uint8_t pointer = op + m->x[l];
+            addr[l] = m->ram[pointer][l] | ((uint16_t) m->ram[(uint8_t) (pointer + 1)][l] << 8);
+            break;
+        }
+        case MODE_INDIRECT_INDEXED:
+            base = m->ram[(uint8_t) op][l] | ((uint16_t) m->ram[(uint8_t) (op + 1)][l] << 8);
+            addr[l] = base + m->y[l];
+            break;
+        default:
+            return false;
+        }
+        if (!is_ram(addr[l]) && (write || addr[l] < 0x8000)) { return false; }
+        bool indexed = d->mode == MODE_ABSOLUTE_X || d->mode == MODE_ABSOLUTE_Y || d->mode == MODE_INDIRECT_INDEXED;
+        if (penalty && indexed && (base & 0xFF00) != (addr[l] & 0xFF00)) { cycles[l]++; }
+    }
+    return true;
+}
+
+static lane_bytes gather(multi_state *m, const lane_set *set, const uint16_t addr[]) {
+    lane_bytes value = { 0 };
+    for (uint8_t i = 0; i < set->count; i++) {
+        uint8_t l = set->lane[i];
+        value[l] = is_ram(addr[l]) ? m->ram[addr[l] & 0x7FF][l] : read_mem(m->lanes[l], addr[l]);
+    }
+    return value;
+}
+
+static void scatter(multi_state *m, const lane_set *set, const uint16_t addr[], lane_bytes value) {
+    for (uint8_t i = 0; i < set->count; i++) {
+        uint8_t l = set->lane[i];
+        m->ram[addr[l] & 0x7FF][l] = value[l];
+    }
+}
+
+// Operands at the same address in every lane are read and written as one vector
+static bool is_uniform(const decoded_instruction *d) {
+    return d->mode == MODE_ZEROPAGE || d->mode == MODE_ABSOLUTE;
+}
+
+static lane_bytes read_operand(multi_state *m, const lane_set *set, const decoded_instruction *d, const uint16_t addr[]) {
+    if (d->mode == MODE_IMMEDIATE) {
+        return (lane_bytes) { 0 } + (uint8_t) d->operand;
+    }
+    if (is_uniform(d)) {
+        uint16_t uniform = addr[set->lane[0]];
+        if (is_ram(uniform)) { return m->ram[uniform & 0x7FF]; }
+        if (!m->banked || same_bank(m, set, uniform)) {
+            return (lane_bytes) { 0 } + read_mem(m->lanes[set->lane[0]], uniform);
+        }
+    }
+    return gather(m, set, addr);
+}
+
+static void write_operand(multi_state *m, const lane_set *set, const decoded_instruction *d, const uint16_t addr[], lane_bytes value) {
+    if (is_uniform(d)) {
+        lane_bytes *ram = &m->ram[addr[set->lane[0]] & 0x7FF];
+        *ram = select_lanes(set->mask, value, *ram);
+        return;
+    }
+    scatter(m, set, addr, value);
+}
+
+static void push(multi_state *m, const lane_set *set, lane_bytes value) {
+    for (uint8_t i = 0; i < set->count; i++) {
+        uint8_t l = set->lane[i];
+        m->ram[0x100 + m->sp[l]][l] = value[l];
+    }
+    m->sp = select_lanes(set->mask, m->sp - 1, m->sp);
+}
+
+static lane_bytes pull(multi_state *m, const lane_set *set) {
+    lane_bytes value = { 0 };
+    m->sp = select_lanes(set->mask, m->sp + 1, m->sp);
+    for (uint8_t i = 0; i < set->count; i++) {
+        uint8_t l = set->lane[i];
+        value[l] = m->ram[0x100 + m->sp[l]][l];
+    }
+    return value;
+}
+
+
+static void implied_op(multi_state *m, const lane_set *set, const multi_opcode *o) {
+    switch (o->op) {
+    case OP_INX: load_nz(m, set, &m->x, m->x + 1); break;
+    case OP_INY: load_nz(m, set, &m->y, m->y + 1); break;
+    case OP_DEX: load_nz(m, set, &m->x, m->x - 1); break;
+    case OP_DEY: load_nz(m, set, &m->y, m->y - 1); break;
+    case OP_TAX: load_nz(m, set, &m->x, m->acc); break;
+    case OP_TAY: load_nz(m, set, &m->y, m->acc); break;
+    case OP_TXA: load_nz(m, set, &m->acc, m->x); break;
+    case OP_TYA: load_nz(m, set, &m->acc, m->y); break;
+    case OP_TSX: load_nz(m, set, &m->x, m->sp); break;
+    case OP_TXS: m->sp = select_lanes(set->mask, m->x, m->sp); break;
+    case OP_PHA: push(m, set, m->acc); break;
+    case OP_PLA: load_nz(m, set, &m->acc, pull(m, set)); break;
+    /* https://wiki.nesdev.com/w/index.php/Status_flags#The_B_flag */
+    case OP_PHP: push(m, set, m->sr | 48); break;
+    case OP_PLP: m->sr = select_lanes(set->mask, (pull(m, set) & 0xcf) | (m->sr & 0x30), m->sr); break;
+    case OP_SET_FLAG: m->sr = select_lanes(set->mask, m->sr | o->flag, m->sr); break;
+    case OP_CLEAR_FLAG: m->sr = select_lanes(set->mask, m->sr & (uint8_t) ~o->flag, m->sr); break;
+    }
+}
+
+// Run the instruction at pc for the lanes of the set.
+// Returns false, without changing anything, if it has to run on the fast core.
+static bool vector_step(multi_state *m, const lane_set *set, uint16_t pc) {
+    const decoded_instruction *d = decode_instruction(m->lanes[set->lane[0]], pc);
+    const multi_opcode *o = &opcodes[d->opcode];
+    if (o->kind == M_NONE || d->program == NULL) { return false; }
+    uint16_t addr[MULTI_LANES];
+    uint8_t cycles[MULTI_LANES];
+    uint16_t next = pc + d->size;
+    for (uint8_t i = 0; i < set->count; i++) {
+        cycles[set->lane[i]] = d->cycles;
+        m->pc[set->lane[i]] = next;
+    }
+
+    switch (o->kind) {
+    case M_READ:
+        if (o->op == OP_NOP) {
+            // Only the page crossing of the absolute,X *NOPs counts
+            for (uint8_t i = 0; i < set->count && d->mode == MODE_ABSOLUTE_X; i++) {
+                uint8_t l = set->lane[i];
+                if ((d->operand & 0xFF00) != ((d->operand + m->x[l]) & 0xFF00)) { cycles[l]++; }
+            }
+            break;
+        }
+        if (d->mode != MODE_IMMEDIATE && !lane_addresses(m, d, set, false, true, addr, cycles)) { goto scalar; }
+        read_op(m, set, o->op, read_operand(m, set, d, addr));
+        break;
+    case M_WRITE: {
+        if (!lane_addresses(m, d, set, true, false, addr, cycles)) { goto scalar; }
+        lane_bytes value = m->acc;
+        if (o->op == OP_STX) { value = m->x; }
+        if (o->op == OP_STY) { value = m->y; }
+        if (o->op == OP_SAX) { value = m->acc & m->x; }
+        write_operand(m, set, d, addr, value);
+        break;
+    }
+    case M_MODIFY: {
+        if (d->mode == MODE_IMPLIED) {
+            m->acc = select_lanes(set->mask, modify_op(m, set, o->op, m->acc), m->acc);
+            break;
+        }
+        if (!lane_addresses(m, d, set, true, false, addr, cycles)) { goto scalar; }
+        lane_bytes value = modify_op(m, set, o->op, read_operand(m, set, d, addr));
+        write_operand(m, set, d, addr, value);
+        if (o->then != OP_NONE) { read_op(m, set, o->then, value); }
+        break;
+    }
+    case M_IMPLIED:
+        implied_op(m, set, o);
+        break;
+    case M_JMP:
+        for (uint8_t i = 0; i < set->count; i++) { m->pc[set->lane[i]] = d->operand; }
+        break;
+    case M_JSR:
+        // The pushed address is the last byte of the JSR
+        push(m, set, (lane_bytes) { 0 } + (uint8_t) ((next - 1) >> 8));
+        push(m, set, (lane_bytes) { 0 } + (uint8_t) (next - 1));
+        for (uint8_t i = 0; i < set->count; i++) { m->pc[set->lane[i]] = d->operand; }
+        break;
+    case M_RTS: {
+        lane_bytes low = pull(m, set);
+        lane_bytes high = pull(m, set);
+        for (uint8_t i = 0; i < set->count; i++) {
+            uint8_t l = set->lane[i];
+            m->pc[l] = (low[l] | ((uint16_t) high[l] << 8)) + 1;
+        }
+        break;
+    }
+    case M_BRANCH: {
+        // Same condition as the branch programs in microcode.c
+        uint16_t target = next + (int8_t) d->operand;
+        lane_bytes taken = (lane_bytes) ((m->sr & d->program->branch_mask) == d->program->branch_value);
+        for (uint8_t i = 0; i < set->count; i++) {
+            uint8_t l = set->lane[i];
+            if (!taken[l]) { continue; }
+            m->pc[l] = target;
+            cycles[l] += 1 + ((next & 0xFF00) != (target & 0xFF00));
+        }
+        break;
+    }
+    }
+    for (uint8_t i = 0; i < set->count; i++) {
+        m->cpu_cycle[set->lane[i]] += cycles[set->lane[i]];
+    }
+    return true;
+
+ scalar:
+    for (uint8_t i = 0; i < set->count; i++) { m->pc[set->lane[i]] = pc; }
+    return false;
+}
+
+
+// Copy a lane in from its state
+static void load_lane(multi_state *m, uint8_t lane) {
+    nes_state *state = m->lanes[lane];
+    registers *regs = state->cpu->registers;
+    build_status_reg(state);
+    m->acc[lane] = regs->ACC;
+    m->x[lane] = regs->X;
+    m->y[lane] = regs->Y;
+    m->sp[lane] = regs->SP;
+    m->sr[lane] = regs->SR;
+    m->pc[lane] = regs->PC;
+    m->cpu_cycle[lane] = state->cpu->cpu_cycle;
+    for (uint16_t i = 0; i < 0x800; i++) {
+        m->ram[i][lane] = state->memory[i];
+    }
+}
+
+void store_lane(multi_state *m, uint8_t lane) {
+    nes_state *state = m->lanes[lane];
+    registers *regs = state->cpu->registers;
+    regs->ACC = m->acc[lane];
+    regs->X = m->x[lane];
+    regs->Y = m->y[lane];
+    regs->SP = m->sp[lane];
+    regs->SR = m->sr[lane];
+    regs->PC = m->pc[lane];
+    state->cpu->lazy_flags = 0;
+    state->cpu->cpu_cycle = m->cpu_cycle[lane];
+    for (uint16_t i = 0; i < 0x800; i++) {
+        state->memory[i] = m->ram[i][lane];
+    }
+}
+
+multi_state *init_multi_state(nes_state *lanes[MULTI_LANES]) {
+    multi_state *m = calloc(1, sizeof(multi_state));
+    m->end_cycle = UINT64_MAX;
+    for (uint8_t l = 0; l < MULTI_LANES; l++) {
+        m->lanes[l] = lanes[l];
+        load_lane(m, l);
+    }
+    // Boards without registers (NROM) never switch
+    m->banked = lanes[0]->mapper != NULL && lanes[0]->mapper->write != NULL;
+    return m;
+}
+
+uint32_t multi_step(multi_state *m) {
+    // The lane furthest behind picks the PC
+    int lead = -1;
+    for (uint8_t l = 0; l < MULTI_LANES; l++) {
+        if (m->stopped[l] || m->cpu_cycle[l] >= m->end_cycle) { continue; }
+        if (lead < 0 || m->cpu_cycle[l] < m->cpu_cycle[lead]) { lead = l; }
+    }
+    if (lead < 0) { return 0; }
+    uint16_t pc = m->pc[lead];
+    // The instruction is decoded once, from the lead, so the lanes must have the same bytes
+    // at pc to pc + 2. The others run when they are furthest behind.
+    bool rom = pc >= 0x8000 && pc <= 0xFFFD;
+    bool check_bank = rom && m->banked;
+    intptr_t code = check_bank ? rom_offset(m, lead, pc) : 0;
+    intptr_t code_end = check_bank ? rom_offset(m, lead, pc + 2) : 0;
+    lane_set set = { .count = 0 };
+    for (uint8_t l = 0; l < MULTI_LANES; l++) {
+        bool in_set = m->pc[l] == pc && !m->stopped[l] && m->cpu_cycle[l] < m->end_cycle &&
+            (!check_bank || (rom_offset(m, l, pc) == code && rom_offset(m, l, pc + 2) == code_end));
+        set.mask[l] = in_set ? 0xFF : 0;
+        if (in_set) { set.lane[set.count++] = l; }
+    }
+    // Code in RAM is decoded from the state, which is only up to date for the fast core
+    if (rom && vector_step(m, &set, pc)) {
+        m->vector_instructions += set.count;
+        return set.count;
+    }
+    for (uint8_t i = 0; i < set.count; i++) {
+        uint8_t l = set.lane[i];
+        store_lane(m, l);
+        cpu_fast_step(m->lanes[l]);
+        load_lane(m, l);
+        m->stopped[l] = m->lanes[l]->fatal_error;
+    }
+    m->scalar_instructions += set.count;
+    return set.count;
+}
+
+void free_multi_state(multi_state *m) {
+    free(m);
+}
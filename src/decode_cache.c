@@ -0,0 +1,127 @@
+#include <stdlib.h>
+#include "decode_cache.h"
+#include "memory.h"
+
+#define IMP MODE_IMPLIED
+#define IMM MODE_IMMEDIATE
+#define ZP MODE_ZEROPAGE
+#define ZPX MODE_ZEROPAGE_X
+#define ZPY MODE_ZEROPAGE_Y
+#define ABS MODE_ABSOLUTE
+#define ABX MODE_ABSOLUTE_X
+#define ABY MODE_ABSOLUTE_Y
+#define REL MODE_RELATIVE
+#define IZX MODE_INDEXED_INDIRECT
+#define IZY MODE_INDIRECT_INDEXED
+#define IND MODE_INDIRECT
+
+// Addressing mode of every opcode, including the illegal ones
+// http://www.oxyron.de/html/opcodes02.html
+static const uint8_t modes[256] = {
+    /*        0    1    2    3    4    5    6    7    8    9    A    B    C    D    E    F */
+    /* 0 */ IMP, IZX, IMP, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* 1 */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPX, ZPX, IMP, ABY, IMP, ABY, ABX, ABX, ABX, ABX,
+    /* 2 */ ABS, IZX, IMP, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* 3 */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPX, ZPX, IMP, ABY, IMP, ABY, ABX, ABX, ABX, ABX,
+    /* 4 */ IMP, IZX, IMP, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* 5 */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPX, ZPX, IMP, ABY, IMP, ABY, ABX, ABX, ABX, ABX,
+    /* 6 */ IMP, IZX, IMP, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, IND, ABS, ABS, ABS,
+    /* 7 */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPX, ZPX, IMP, ABY, IMP, ABY, ABX, ABX, ABX, ABX,
+    /* 8 */ IMM, IZX, IMM, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* 9 */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPY, ZPY, IMP, ABY, IMP, ABY, ABX, ABX, ABY, ABY,
+    /* A */ IMM, IZX, IMM, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* B */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPY, ZPY, IMP, ABY, IMP, ABY, ABX, ABX, ABY, ABY,
+    /* C */ IMM, IZX, IMM, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* D */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPX, ZPX, IMP, ABY, IMP, ABY, ABX, ABX, ABX, ABX,
+    /* E */ IMM, IZX, IMM, IZX, ZP,  ZP,  ZP,  ZP,  IMP, IMM, IMP, IMM, ABS, ABS, ABS, ABS,
+    /* F */ REL, IZY, IMP, IZY, ZPX, ZPX, ZPX, ZPX, IMP, ABY, IMP, ABY, ABX, ABX, ABX, ABX,
+};
+
+uint8_t opcode_mode(uint8_t opcode) {
+    return modes[opcode];
+}
+
+static uint8_t mode_size(uint8_t mode) {
+    switch (mode) {
+    case MODE_IMPLIED:
+        return 1;
+    case MODE_ABSOLUTE:
+    case MODE_ABSOLUTE_X:
+    case MODE_ABSOLUTE_Y:
+    case MODE_INDIRECT:
+        return 3;
+    default:
+        return 2;
+    }
+}
+
+// Code runs from memory pages, where peek_mem reads the same as read_mem. Peeking keeps
+// the decode at an instruction boundary (for the log) from touching the io registers.
+static void decode(nes_state *state, decoded_instruction *d, uint16_t pc) {
+    d->opcode = peek_mem(state, pc);
+    d->mode = modes[d->opcode];
+    d->size = mode_size(d->mode);
+    d->program = microcode[d->opcode].length > 0 ? &microcode[d->opcode] : NULL;
+    // Unknown opcodes only fetch the opcode, see unknown_program
+    d->cycles = 1;
+    if (d->program != NULL) {
+        // The length of a branch program includes the taken cycle
+        d->cycles = d->program->length - (d->program->branch_mask ? 1 : 0);
+    }
+    d->operand = 0;
+    if (d->size > 1) { d->operand = peek_mem(state, pc + 1); }
+    if (d->size > 2) { d->operand |= (uint16_t) peek_mem(state, (uint16_t) (pc + 2)) << 8; }
+    d->valid = true;
+}
+
+const decoded_instruction *decode_instruction(nes_state *state, uint16_t pc) {
+    if (state->decode_cache == NULL) {
+        state->decode_cache = calloc(1, sizeof(decode_cache));
+    }
+    decode_cache *cache = state->decode_cache;
+    if (pc < 0x8000) {
+        decode(state, &cache->uncached, pc);
+        return &cache->uncached;
+    }
+    decoded_instruction *entries = cache->pages[(pc >> 8) - 0x80];
+    // Instructions at the end of a page may have their operands in another bank (or in RAM, past $FFFF)
+    if (entries == NULL || (pc & 0xFF) > 0xFD) {
+        const uint8_t *page = state->map.read[pc >> 8];
+        if (page == NULL || pc > 0xFFFD || ((pc & 0xFF) > 0xFD && state->map.read[(pc >> 8) + 1] != page + 0x100)) {
+            decode(state, &cache->uncached, pc);
+            return &cache->uncached;
+        }
+        if (cache->entries == NULL) {
+            cache->entries = calloc(state->rom->prg_rom_size * 0x4000, sizeof(decoded_instruction));
+        }
+        entries = &cache->entries[page - state->rom->prg_rom];
+        cache->pages[(pc >> 8) - 0x80] = entries;
+    }
+    decoded_instruction *d = &entries[pc & 0xFF];
+    if (!d->valid) {
+        decode(state, d, pc);
+    }
+    return d;
+}
+
+void flush_decode_cache(nes_state *state) {
+    invalidate_fetch_page(state);
+    if (state->decode_cache == NULL) { return; }
+    // Allocated again for the size of the new rom
+    free(state->decode_cache->entries);
+    state->decode_cache->entries = NULL;
+    remap_decode_cache(state, 0x8000, 0x8000);
+}
+
+void remap_decode_cache(nes_state *state, uint16_t addr, uint32_t size) {
+    if (state->decode_cache == NULL || addr < 0x8000) { return; }
+    for (uint32_t page = addr >> 8; page < (addr + size) >> 8; page++) {
+        state->decode_cache->pages[page - 0x80] = NULL;
+    }
+}
+
+void free_decode_cache(nes_state *state) {
+    if (state->decode_cache != NULL) { free(state->decode_cache->entries); }
+    free(state->decode_cache);
+    state->decode_cache = NULL;
+}
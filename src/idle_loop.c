@@ -0,0 +1,129 @@
+#include <stdlib.h>
+#include "idle_loop.h"
+#include "cpu.h"
+#include "decode_cache.h"
+#include "memory.h"
+#include "ppu.h"
+
+// Instructions that can be part of an idle loop. They don't write memory or touch the stack,
+// so running the loop again from the same registers and the same value read gives the same result.
+static bool is_side_effect_free(uint8_t opcode) {
+    switch (opcode) {
+    // LDA, LDX, LDY, BIT, AND, ORA, EOR, CMP, CPX, CPY, ADC, SBC zero page and absolute
+    case 0xA5: case 0xAD: case 0xA6: case 0xAE: case 0xA4: case 0xAC:
+    case 0x24: case 0x2C: case 0x25: case 0x2D: case 0x05: case 0x0D:
+    case 0x45: case 0x4D: case 0xC5: case 0xCD: case 0xE4: case 0xEC:
+    case 0xC4: case 0xCC: case 0x65: case 0x6D: case 0xE5: case 0xED:
+    // The same, immediate
+    case 0xA9: case 0xA2: case 0xA0: case 0x29: case 0x09: case 0x49:
+    case 0xC9: case 0xE0: case 0xC0: case 0x69: case 0xE9:
+    // TAX, TAY, TXA, TYA, INX, INY, DEX, DEY, CLC, SEC, CLV, NOP
+    case 0xAA: case 0xA8: case 0x8A: case 0x98: case 0xE8: case 0xC8:
+    case 0xCA: case 0x88: case 0x18: case 0x38: case 0xB8: case 0xEA:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// RAM, and $2002 (and its mirrors), whose only side effect on read is gone after the first one
+static bool is_watchable(uint16_t addr) {
+    return addr < 0x2000 || (addr >= 0x2000 && addr <= 0x3FFF && (addr & 0x7) == 0x2);
+}
+
+// Check if the code at head is a loop of side effect free instructions that reads one
+// watchable address and ends with a branch back to head.
+static bool find_idle_loop(nes_state *state, idle_loop *loop, uint16_t head) {
+    // Only loops in RAM and ROM, the io registers don't hold code
+    if (head >= 0x2000 && head < 0x8000) { return false; }
+    uint16_t pc = head;
+    uint8_t cycles = 0;
+    bool reads = false;
+    for (uint8_t i = 0; i < MAX_IDLE_LOOP_LENGTH; i++) {
+        const decoded_instruction *d = decode_instruction(state, pc);
+        if (d->program == NULL) { return false; }
+        cycles += d->cycles;
+        if (d->mode == MODE_RELATIVE) {
+            uint16_t next = pc + 2;
+            if ((uint16_t) (next + (int8_t) d->operand) != head) { return false; }
+            // The branch is taken, and takes another cycle if it crosses a page
+            loop->cycles = cycles + 1 + ((next & 0xFF00) != (head & 0xFF00) ? 1 : 0);
+            return reads;
+        }
+        if (!is_side_effect_free(d->opcode)) { return false; }
+        if (d->mode == MODE_ZEROPAGE || d->mode == MODE_ABSOLUTE) {
+            // Only one location is watched
+            if (reads || !is_watchable(d->operand)) { return false; }
+            loop->watched = d->operand;
+            reads = true;
+        }
+        pc += d->size;
+    }
+    return false;
+}
+
+static void remember_arrival(nes_state *state, idle_loop *loop) {
+    registers *regs = state->cpu->registers;
+    loop->arrived_cycle = state->cpu->cpu_cycle;
+    loop->acc = regs->ACC;
+    loop->x = regs->X;
+    loop->y = regs->Y;
+    loop->sp = regs->SP;
+    loop->sr = regs->SR;
+    loop->value = loop->candidate ? peek_mem(state, loop->watched) : 0;
+}
+
+static bool same_as_last_arrival(nes_state *state, idle_loop *loop) {
+    registers *regs = state->cpu->registers;
+    return state->cpu->cpu_cycle - loop->arrived_cycle == loop->cycles
+        && regs->ACC == loop->acc && regs->X == loop->x && regs->Y == loop->y
+        && regs->SP == loop->sp && regs->SR == loop->sr
+        && peek_mem(state, loop->watched) == loop->value;
+}
+
+uint32_t skip_idle_loop(nes_state *state, uint32_t budget) {
+    idle_loop *loop = state->idle_loop;
+    cpu_state *cpu = state->cpu;
+    uint16_t pc = cpu->registers->PC;
+    // A loop is entered again by the branch back to its head.
+    // current_opcode is still the instruction that just ran.
+    if ((cpu->current_opcode & 0x1F) != 0x10 || pc >= cpu->current_opcode_PC) {
+        return 0;
+    }
+    build_status_reg(state);
+    if (!loop->candidate || loop->head != pc) {
+        loop->head = pc;
+        loop->candidate = find_idle_loop(state, loop, pc);
+        remember_arrival(state, loop);
+        return 0;
+    }
+    // The last iteration started from the same state and read the same value, and took
+    // the cycles it should. Every iteration will, until something changes the value.
+    // Only the ppu can: by setting the VBlank flag, or by the NMI that follows it.
+    // A polled interrupt is left to the core.
+    if (!same_as_last_arrival(state, loop) || state->cpu->polled_interrupt != 0) {
+        remember_arrival(state, loop);
+        return 0;
+    }
+    uint32_t iterations = ppu_dots_to_next_event(state) / (3 * loop->cycles);
+    // Leave the last iteration before the event to the core
+    if (iterations > 0) { iterations--; }
+    if (iterations > budget / loop->cycles) { iterations = budget / loop->cycles; }
+    uint32_t cycles = iterations * loop->cycles;
+    cpu->cpu_cycle += cycles;
+    state->master_clock += cycles;
+    ppu_skip(state, 3 * cycles);
+    loop->arrived_cycle = cpu->cpu_cycle;
+    return cycles;
+}
+
+void enable_idle_loop_skipping(nes_state *state) {
+    if (state->idle_loop == NULL) {
+        state->idle_loop = calloc(1, sizeof(idle_loop));
+    }
+}
+
+void free_idle_loop(nes_state *state) {
+    free(state->idle_loop);
+    state->idle_loop = NULL;
+}
@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include "interrupt.h"
+#include "cpu.h"
+#include "profiler.h"
+
+// Every interrupt source drives its line here, and the cores only test
+// cpu->interrupt_lines between instructions (the cycle core every cycle).
+
+void raise_irq(nes_state *state, uint8_t line) {
+    state->cpu->interrupt_lines |= line & IRQ_LINES;
+}
+
+void lower_irq(nes_state *state, uint8_t line) {
+    state->cpu->interrupt_lines &= ~(line & IRQ_LINES);
+}
+
+void set_nmi_line(nes_state *state, bool level) {
+    if (level && !state->cpu->nmi_line) {
+        state->cpu->interrupt_lines |= NMI_EDGE;
+    }
+    state->cpu->nmi_line = level;
+}
+
+uint16_t poll_interrupts(nes_state *state) {
+    uint8_t lines = state->cpu->interrupt_lines;
+    if (lines & NMI_EDGE) {
+        return NMI_VECTOR;
+    }
+    if ((lines & IRQ_LINES) && !is_interrupt_flag_set(state)) {
+        return IRQ_VECTOR;
+    }
+    return 0;
+}
+
+void acknowledge_interrupt(nes_state *state, uint16_t vector) {
+    printf("Interrupt triggered!\n");
+    profile_interrupt(state, vector);
+    if (vector == NMI_VECTOR) {
+        state->cpu->interrupt_lines &= ~NMI_EDGE;
+    }
+}
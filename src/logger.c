@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include "logger.h"
 #include "memory.h"
+#include "cpu.h"
 FILE *logfile;
 
 
@@ -13,11 +14,11 @@ void disass(nes_state *state, char *output) {
     // ORA indirect,X
   case 0x01:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     ORA ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -32,11 +33,11 @@ void disass(nes_state *state, char *output) {
     // *SLO indirect,X - Illegal instruction
   case 0x03:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *SLO ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -54,14 +55,14 @@ void disass(nes_state *state, char *output) {
   case 0x44:
   case 0x64:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *NOP $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
       break;
 
@@ -74,8 +75,8 @@ void disass(nes_state *state, char *output) {
   case 0xDC:
   case 0xFC:      
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -86,13 +87,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *NOP $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -100,41 +101,41 @@ void disass(nes_state *state, char *output) {
     // ORA Zeropage
   case 0x05:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     ORA $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     // ASL Zeropage
   case 0x06:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     ASL $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *SLO Zeropage - Illegal instruction
   case 0x07:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *SLO $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -152,8 +153,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     ORA #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // ASL A
@@ -179,25 +180,25 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X    *NOP #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
 
     
     // *NOP Absolute - illegal opcode
   case 0x0C:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *NOP $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     // *NOP Zeropage, X - illegal opcode
@@ -208,16 +209,16 @@ void disass(nes_state *state, char *output) {
   case 0xD4:
   case 0xF4:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *NOP $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -227,51 +228,51 @@ void disass(nes_state *state, char *output) {
     // ORA Absolute
   case 0x0D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  ORA $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // ASL Absolute
   case 0x0E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  ASL $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *SLO Absolute - Illegal instruction
   case 0x0F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *SLO $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -281,16 +282,16 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BPL $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
 
     // ORA indirect-indexed,Y
   case 0x11:
     {
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
@@ -302,14 +303,14 @@ void disass(nes_state *state, char *output) {
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
 
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     ORA ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -326,15 +327,15 @@ void disass(nes_state *state, char *output) {
     // *SLO indirect-indexed,Y - Illegal instruction
   case 0x13:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *SLO ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -351,48 +352,48 @@ void disass(nes_state *state, char *output) {
     // ORA Zeropage, X
   case 0x15:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     ORA $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // ASL Zeropage, X
   case 0x16:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     ASL $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *SLO Zeropage, X - Illegal instruction
   case 0x17:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *SLO $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -406,8 +407,8 @@ void disass(nes_state *state, char *output) {
 // ORA Absolute Y
   case 0x19:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -418,13 +419,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ORA $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
       
   }
   break;
@@ -433,8 +434,8 @@ void disass(nes_state *state, char *output) {
 // *SLO Absolute Y - Illegal instruction
   case 0x1B:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -445,13 +446,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *SLO $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
       
   }
   break;
@@ -460,8 +461,8 @@ void disass(nes_state *state, char *output) {
     // ORA Absolute X
   case 0x1D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -472,21 +473,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ORA $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // ASL Absolute X
   case 0x1E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -497,21 +498,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ASL $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
     // *SLO Absolute X - Illegal instruction
   case 0x1F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -522,13 +523,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *SLO $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -538,10 +539,10 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X %02X  JSR $%02X%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+2),
-            read_mem(state, state->cpu->current_opcode_PC+2),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+2),
+            peek_mem(state, state->cpu->current_opcode_PC+2),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
 
 
@@ -549,11 +550,11 @@ void disass(nes_state *state, char *output) {
     // AND indirect,X
   case 0x21:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     AND ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -568,11 +569,11 @@ void disass(nes_state *state, char *output) {
     // *RLA indirect,X - ROL followed by AND
   case 0x23:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *RLA ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -591,37 +592,37 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BIT $%02X = %02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, read_mem(state, state->cpu->current_opcode_PC+1)));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, peek_mem(state, state->cpu->current_opcode_PC+1)));
     break;
 
     
     // AND Zeropage
   case 0x25:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     AND $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // ROL Zeropage
   case 0x26:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     ROL $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -629,14 +630,14 @@ void disass(nes_state *state, char *output) {
     // *RLA Zeropage - Illegal instruction
   case 0x27:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *RLA $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -652,8 +653,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     AND #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     // ROR A
   case 0x2A:
@@ -664,67 +665,67 @@ void disass(nes_state *state, char *output) {
     // BIT Absolute
   case 0x2C:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  BIT $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     // AND Absolute
   case 0x2D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  AND $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // ROL Absolute
   case 0x2E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  ROL $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *RLA Absolute - Illegal instruction
   case 0x2F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *RLA $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -734,17 +735,17 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BMI $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
 
     // AND indirect-indexed,Y
   case 0x31:
     {
 
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
@@ -754,15 +755,15 @@ void disass(nes_state *state, char *output) {
       /* } */
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     AND ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -779,14 +780,14 @@ void disass(nes_state *state, char *output) {
   case 0x33:
     {
 
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *RLA ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -804,48 +805,48 @@ void disass(nes_state *state, char *output) {
     // AND Zeropage, X
   case 0x35:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     AND $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // ROL Zeropage, X
   case 0x36:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     ROL $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
     // *RLA Zeropage, X
   case 0x37:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *RLA $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
@@ -859,8 +860,8 @@ void disass(nes_state *state, char *output) {
 // AND Absolute Y
   case 0x39:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -871,23 +872,23 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  AND $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              /* read_mem(state, state->cpu->current_opcode_PC+2), */
-              /* read_mem(state, state->cpu->current_opcode_PC+1), */
-              read_mem(state, addr));
+              /* peek_mem(state, state->cpu->current_opcode_PC+2), */
+              /* peek_mem(state, state->cpu->current_opcode_PC+1), */
+              peek_mem(state, addr));
       
   }
   break;
   // *RLA Absolute Y - Illegal instruction
   case 0x3B:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -898,21 +899,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *RLA $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
   
     // AND Absolute X
   case 0x3D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -923,21 +924,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  AND $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // ROL Absolute X
   case 0x3E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -948,21 +949,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ROL $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *RLA Absolute X
   case 0x3F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -973,13 +974,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *RLA $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -993,11 +994,11 @@ void disass(nes_state *state, char *output) {
     // EOR indirect,X
   case 0x41:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     EOR ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1012,11 +1013,11 @@ void disass(nes_state *state, char *output) {
     // *SRE indirect,X - Illegal instruction
   case 0x43:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *SRE ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1032,42 +1033,42 @@ void disass(nes_state *state, char *output) {
   // EOR Zeropage
   case 0x45:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     EOR $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // LSR Zeropage
   case 0x46:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     LSR $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *SRE Zeropage - Illegal instruction
   case 0x47:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *SRE $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -1083,8 +1084,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     EOR #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     // LSR A
   case 0x4A:
@@ -1098,25 +1099,25 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X %02X  JMP $%02X%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+2),
-            read_mem(state, state->cpu->current_opcode_PC+2),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+2),
+            peek_mem(state, state->cpu->current_opcode_PC+2),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     // EOR Absolute
   case 0x4D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  EOR $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -1126,34 +1127,34 @@ void disass(nes_state *state, char *output) {
     // LSR Absolute
   case 0x4E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  LSR $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *SRE Absolute - Illegal instruction
   case 0x4F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *SRE $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -1163,16 +1164,16 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BVC $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
 
     // EOR indirect-indexed,Y
   case 0x51:
     {
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
@@ -1182,15 +1183,15 @@ void disass(nes_state *state, char *output) {
       /* } */
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     EOR ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1206,14 +1207,14 @@ void disass(nes_state *state, char *output) {
     // *SRE indirect-indexed,Y
   case 0x53:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *SRE ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1230,48 +1231,48 @@ void disass(nes_state *state, char *output) {
     // EOR Zeropage, X
   case 0x55:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     EOR $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // LSR Zeropage, X
   case 0x56:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     LSR $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *SRE Zeropage, X
   case 0x57:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *SRE $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -1280,8 +1281,8 @@ void disass(nes_state *state, char *output) {
 // EOR Absolute Y
   case 0x59:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -1292,21 +1293,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  EOR $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
 
   // *SRE Absolute Y
   case 0x5B:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -1317,13 +1318,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *SRE $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
 
@@ -1332,8 +1333,8 @@ void disass(nes_state *state, char *output) {
     // EOR Absolute X
   case 0x5D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -1344,21 +1345,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  EOR $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // LSR Absolute X
   case 0x5E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -1369,21 +1370,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  LSR $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
   // *SRE Absolute X
   case 0x5F:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -1394,13 +1395,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *SRE $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
   
@@ -1414,11 +1415,11 @@ void disass(nes_state *state, char *output) {
     // ADC indirect,X
   case 0x61:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     ADC ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1433,11 +1434,11 @@ void disass(nes_state *state, char *output) {
     // *RRA indirect,X - Illegal instruction
   case 0x63:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *RRA ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1454,42 +1455,42 @@ void disass(nes_state *state, char *output) {
     // ADC Zeropage
   case 0x65:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     ADC $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // ROR Zeropage
   case 0x66:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     ROR $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // *RRA Zeropage - Illegal instruction
   case 0x67:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *RRA $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
@@ -1505,8 +1506,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     ADC #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // ROR A
@@ -1519,15 +1520,15 @@ void disass(nes_state *state, char *output) {
     // JMP indirect
   case 0x6C:
     {
-      uint8_t operand1 = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t operand2 = read_mem(state, state->cpu->current_opcode_PC+2);
+      uint8_t operand1 = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand2 = peek_mem(state, state->cpu->current_opcode_PC+2);
       uint16_t addr_addr1 = (uint16_t) operand1 | ((uint16_t) operand2) << 8;
       // Ensure page wrap is handled
       uint16_t addr_addr2 = addr_addr1 + 1;
       if (!((addr_addr1 & 0xff00) == (addr_addr2 & 0xff00))) {
         addr_addr2 = (addr_addr1 & 0xff00);
       }
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr1)) | (((uint16_t) read_mem(state, addr_addr2)) << 8);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr1)) | (((uint16_t) peek_mem(state, addr_addr2)) << 8);
 
       sprintf(output, "%04X  %02X %02X %02X  JMP ($%04X) = %04X",
               state->cpu->current_opcode_PC,
@@ -1543,51 +1544,51 @@ void disass(nes_state *state, char *output) {
     // ADC Absolute
   case 0x6D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  ADC $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // ROR Absolute
   case 0x6E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  ROR $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *RRA Absolute
   case 0x6F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *RRA $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -1597,20 +1598,20 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BVS $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
 
     // ADC indirect-indexed,Y
   case 0x71:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     ADC ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1626,14 +1627,14 @@ void disass(nes_state *state, char *output) {
     // *RRA indirect-indexed,Y
   case 0x73:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *RRA ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1650,48 +1651,48 @@ void disass(nes_state *state, char *output) {
     // ADC Zeropage, X
   case 0x75:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     ADC $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // ROR Zeropage, X
   case 0x76:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     ROR $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *RRA Zeropage, X
   case 0x77:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *RRA $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
@@ -1706,8 +1707,8 @@ void disass(nes_state *state, char *output) {
 // ADC Absolute Y
   case 0x79:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -1718,21 +1719,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ADC $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
 
   // *RRA Absolute Y - Illegal instruction
   case 0x7B:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -1743,21 +1744,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *RRA $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
   
     // ADC Absolute X
   case 0x7D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -1768,21 +1769,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ADC $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // ROR Absolute X
   case 0x7E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -1793,21 +1794,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  ROR $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
   // *RRA Absolute X - Illegal instruction
   case 0x7F:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -1818,13 +1819,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *RRA $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));      
+              peek_mem(state, addr));      
   }
   break;
     
@@ -1833,11 +1834,11 @@ void disass(nes_state *state, char *output) {
     // STA indirect,X
   case 0x81:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     STA ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1853,11 +1854,11 @@ void disass(nes_state *state, char *output) {
     // *SAX indirect,X - Illegal instruction, ACC AND X -> Memory
   case 0x83:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *SAX ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -1877,27 +1878,27 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     STY $%02X = %02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, read_mem(state, state->cpu->current_opcode_PC+1)));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, peek_mem(state, state->cpu->current_opcode_PC+1)));
     break;
     //STA Zero Page
   case 0x85:
     sprintf(output, "%04X  %02X %02X     STA $%02X = %02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, read_mem(state, state->cpu->current_opcode_PC+1)));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, peek_mem(state, state->cpu->current_opcode_PC+1)));
     break;
     //STX Zero Page
   case 0x86:
     sprintf(output, "%04X  %02X %02X     STX $%02X = %02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, read_mem(state, state->cpu->current_opcode_PC+1)));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, peek_mem(state, state->cpu->current_opcode_PC+1)));
     break;
 
     // *SAX Zero Page - illegal instruction
@@ -1905,9 +1906,9 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X    *SAX $%02X = %02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, read_mem(state, state->cpu->current_opcode_PC+1)));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, peek_mem(state, state->cpu->current_opcode_PC+1)));
     break;
 
     
@@ -1926,67 +1927,67 @@ void disass(nes_state *state, char *output) {
     //STY Absolute
   case 0x8C:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  STY $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     //STA Absolute
   case 0x8D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  STA $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     //STX Absolute
   case 0x8E:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-        addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+        addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
         sprintf(output, "%04X  %02X %02X %02X  STX $%02X%02X = %02X",
                 state->cpu->current_opcode_PC,
                 state->cpu->current_opcode,
-                read_mem(state, state->cpu->current_opcode_PC+1),
-                read_mem(state, state->cpu->current_opcode_PC+2),
-                read_mem(state, state->cpu->current_opcode_PC+2),
-                read_mem(state, state->cpu->current_opcode_PC+1),
-                read_mem(state, addr));
+                peek_mem(state, state->cpu->current_opcode_PC+1),
+                peek_mem(state, state->cpu->current_opcode_PC+2),
+                peek_mem(state, state->cpu->current_opcode_PC+2),
+                peek_mem(state, state->cpu->current_opcode_PC+1),
+                peek_mem(state, addr));
       }
     break;
 
     //SAX Absolute - Illegal instruction
   case 0x8F:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *SAX $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -1997,8 +1998,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BCC $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
 
 
@@ -2006,12 +2007,12 @@ void disass(nes_state *state, char *output) {
   case 0x91:
     {
 
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
       low_addr += state->cpu->registers->Y;
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     STA ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2027,64 +2028,64 @@ void disass(nes_state *state, char *output) {
     // STY Zeropage, X
   case 0x94:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     STY $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
     // STA Zeropage, X
   case 0x95:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     STA $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // STX Zeropage, Y
   case 0x96:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->Y;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     STX $%02X,Y @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *SAX Zeropage, Y - Illegal instruction
   case 0x97:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->Y;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *SAX $%02X,Y @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
@@ -2100,8 +2101,8 @@ void disass(nes_state *state, char *output) {
   // STA Absolute Y
   case 0x99:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -2112,15 +2113,15 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  STA $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              /* read_mem(state, state->cpu->current_opcode_PC+2), */
-              /* read_mem(state, state->cpu->current_opcode_PC+1), */
-              read_mem(state, addr));
+              /* peek_mem(state, state->cpu->current_opcode_PC+2), */
+              /* peek_mem(state, state->cpu->current_opcode_PC+1), */
+              peek_mem(state, addr));
       
   }
   break;
@@ -2137,8 +2138,8 @@ void disass(nes_state *state, char *output) {
     // STA Absolute X
   case 0x9D:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -2149,13 +2150,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  STA $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -2165,18 +2166,18 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     LDY #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // LDA indirect,X
   case 0xA1:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     LDA ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2193,18 +2194,18 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     LDX #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
 
     // *LAX indirect,X - Illegal opcode, combines LDA and LDX
   case 0xA3:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *LAX ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2221,20 +2222,20 @@ void disass(nes_state *state, char *output) {
     // LDY Zeropage
   case 0xA4:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     LDY $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     // LDA Zeropage
   case 0xA5:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
 
       sprintf(output, "%04X  %02X %02X     LDA $%02X = %02X",
@@ -2242,22 +2243,22 @@ void disass(nes_state *state, char *output) {
               state->cpu->current_opcode,
               addr,
               addr,
-              /* read_mem(state, state->cpu->current_opcode_PC+1), */
-              /* read_mem(state, state->cpu->current_opcode_PC+1), */
-              read_mem(state, addr));
+              /* peek_mem(state, state->cpu->current_opcode_PC+1), */
+              /* peek_mem(state, state->cpu->current_opcode_PC+1), */
+              peek_mem(state, addr));
     }
     break;
     // LDX Zeropage
   case 0xA6:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     LDX $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -2266,9 +2267,9 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X    *LAX $%02X = %02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, read_mem(state, state->cpu->current_opcode_PC+1)));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, peek_mem(state, state->cpu->current_opcode_PC+1)));
     break;
 
     
@@ -2284,8 +2285,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     LDA #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // TAX
@@ -2298,68 +2299,68 @@ void disass(nes_state *state, char *output) {
     // LDY Absolute
   case 0xAC:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  LDY $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // LDA Absolute
   case 0xAD:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  LDA $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // LDX Absolute
   case 0xAE:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  LDX $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *LAX Absolute - Illegal opcode
   case 0xAF:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *LAX $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -2369,8 +2370,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BCS $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
     
     // LDA indirect-indexed,Y
@@ -2380,9 +2381,9 @@ void disass(nes_state *state, char *output) {
       /*   LDA ($02),Y */
       /*   In the above case, Y is loaded with four (4), and the vector is given as ($02) */
       /* If zero page memory $02-$03 contains 00 80, then the effective address from the vector ($02) plus the offset (Y) would be $8004. */
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       // check if page boundary was crossed and fix addresses
       uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
@@ -2394,7 +2395,7 @@ void disass(nes_state *state, char *output) {
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     LDA ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2415,9 +2416,9 @@ void disass(nes_state *state, char *output) {
       /* /\*   In the above case, Y is loaded with four (4), and the vector is given as ($02) *\/ */
       /* /\* If zero page memory $02-$03 contains 00 80, then the effective address from the vector ($02) plus the offset (Y) would be $8004. *\/ */
 
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* /\* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; *\/ */
@@ -2429,14 +2430,14 @@ void disass(nes_state *state, char *output) {
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
 
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *LAX ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2454,64 +2455,64 @@ void disass(nes_state *state, char *output) {
     // LDY Zeropage, X
   case 0xB4:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     LDY $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // LDA Zeropage, X
   case 0xB5:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     LDA $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
     // LDX Zeropage, Y
   case 0xB6:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->Y;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     LDX $%02X,Y @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *LAX Zeropage, Y - Illegal instruction
   case 0xB7:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->Y;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *LAX $%02X,Y @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -2526,8 +2527,8 @@ void disass(nes_state *state, char *output) {
     // Load Accumuator Absolute Y
   case 0xB9:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -2538,13 +2539,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  LDA $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
     
@@ -2559,8 +2560,8 @@ void disass(nes_state *state, char *output) {
     // Load Y Absolute X
   case 0xBC:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -2571,21 +2572,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  LDY $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // LDA Absolute X
   case 0xBD:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -2596,21 +2597,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  LDA $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // LDX Absolute Y
   case 0xBE:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -2621,21 +2622,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  LDX $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *LAX Absolute X
   case 0xBF:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -2646,13 +2647,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *LAX $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -2662,18 +2663,18 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     CPY #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // CMP indirect,X
   case 0xC1:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     CMP ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2689,11 +2690,11 @@ void disass(nes_state *state, char *output) {
     // Equivalent to DEC value followed by CMP value
   case 0xC3:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *DCP ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2710,56 +2711,56 @@ void disass(nes_state *state, char *output) {
     // CPY Zeropage
   case 0xC4:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     CPY $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // CMP Zeropage
   case 0xC5:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     CMP $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // DEC Zeropage
   case 0xC6:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     DEC $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *DCP Zeropage - Illegal instruction
   case 0xC7:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *DCP $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -2777,8 +2778,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     CMP #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     // DEX
   case 0xCA:
@@ -2790,68 +2791,68 @@ void disass(nes_state *state, char *output) {
     // CPY Absolute
   case 0xCC:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  CPY $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // CMP Absolute
   case 0xCD:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  CMP $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // DEC Absolute
   case 0xCE:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X  DEC $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *DCP Absolute - Illegal Instruction
   case 0xCF:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X %02X *DCP $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
@@ -2861,16 +2862,16 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BNE $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + ((int8_t) read_mem(state, state->cpu->current_opcode_PC+1)) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + ((int8_t) peek_mem(state, state->cpu->current_opcode_PC+1)) + 2);
     break;
 
     // CMP indirect-indexed,Y
   case 0xD1:
     {
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
@@ -2880,14 +2881,14 @@ void disass(nes_state *state, char *output) {
       /* } */
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     CMP ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2903,14 +2904,14 @@ void disass(nes_state *state, char *output) {
     // *DCP indirect-indexed,Y - Illegal instruction
   case 0xD3:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *DCP ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -2926,48 +2927,48 @@ void disass(nes_state *state, char *output) {
     // CMP Zeropage, X
   case 0xD5:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     CMP $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // DEC Zeropage, X
   case 0xD6:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     DEC $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *DCP Zeropage, X -- Illegal instruction
   case 0xD7:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *DCP $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -2982,8 +2983,8 @@ void disass(nes_state *state, char *output) {
   // CMP Absolute Y
   case 0xD9:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -2994,21 +2995,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  CMP $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));    
+              peek_mem(state, addr));    
   }
   break;
 
   // *DCP Absolute Y - Illegal instruction
   case 0xDB:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -3019,13 +3020,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *DCP $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));    
+              peek_mem(state, addr));    
   }
   break;
 
@@ -3033,8 +3034,8 @@ void disass(nes_state *state, char *output) {
     // CMP Absolute X
   case 0xDD:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -3045,21 +3046,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  CMP $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // DEC Absolute X
   case 0xDE:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -3070,21 +3071,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  DEC $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
   // *DCP Absolute X - Illegal instruction
   case 0xDF:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -3095,13 +3096,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *DCP $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));    
+              peek_mem(state, addr));    
   }
   break;
 
@@ -3113,18 +3114,18 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     CPX #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // SBC indirect,X
   case 0xE1:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     SBC ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -3139,11 +3140,11 @@ void disass(nes_state *state, char *output) {
     // *ISB indirect,X
   case 0xE3:
     {
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
       uint16_t addr_addr = (uint16_t) state->cpu->registers->X + (uint16_t) operand;
       addr_addr &= 0xFF;
-      uint16_t effective_addr = ((uint16_t) read_mem(state, addr_addr)) | (((uint16_t) read_mem(state, (addr_addr+1) & 0xFF)) << 8);
-      uint8_t value = read_mem(state, effective_addr);
+      uint16_t effective_addr = ((uint16_t) peek_mem(state, addr_addr)) | (((uint16_t) peek_mem(state, (addr_addr+1) & 0xFF)) << 8);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *ISB ($%02X,X) @ %02X = %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -3160,55 +3161,55 @@ void disass(nes_state *state, char *output) {
     // CPX Zeropage
   case 0xE4:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       sprintf(output, "%04X  %02X %02X     CPX $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // SBC Zeropage
   case 0xE5:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     SBC $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // INC Zeropage
   case 0xE6:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X     INC $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *ISB Zeropage - Illegal instruction
   case 0xE7:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
 
       sprintf(output, "%04X  %02X %02X    *ISB $%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -3225,8 +3226,8 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     SBC #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // NOP
@@ -3241,71 +3242,71 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X    *SBC #$%02X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            read_mem(state, state->cpu->current_opcode_PC+1));
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            peek_mem(state, state->cpu->current_opcode_PC+1));
     break;
     
     // CPX Absolute
   case 0xEC:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       sprintf(output, "%04X  %02X %02X %02X  CPX $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // SBC Absolute
   case 0xED:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       sprintf(output, "%04X  %02X %02X %02X  SBC $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
     
     // INC Absolute
   case 0xEE:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       sprintf(output, "%04X  %02X %02X %02X  INC $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
     // *ISB Absolute - Illegal instruction
   case 0xEF:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       sprintf(output, "%04X  %02X %02X %02X *ISB $%02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, addr));
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, addr));
     }
     break;
 
@@ -3315,16 +3316,16 @@ void disass(nes_state *state, char *output) {
     sprintf(output, "%04X  %02X %02X     BEQ $%04X",
             state->cpu->current_opcode_PC,
             state->cpu->current_opcode,
-            read_mem(state, state->cpu->current_opcode_PC+1),
-            state->cpu->current_opcode_PC + read_mem(state, state->cpu->current_opcode_PC+1) + 2);
+            peek_mem(state, state->cpu->current_opcode_PC+1),
+            state->cpu->current_opcode_PC + peek_mem(state, state->cpu->current_opcode_PC+1) + 2);
     break;
 
     // SBC indirect-indexed,Y
   case 0xF1:
     {
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
@@ -3334,14 +3335,14 @@ void disass(nes_state *state, char *output) {
       /* } */
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X     SBC ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -3357,9 +3358,9 @@ void disass(nes_state *state, char *output) {
     // *ISB indirect-indexed,Y - Illegal instruction
   case 0xF3:
     {
-      /* uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1); */
-      /* uint8_t low_addr = read_mem(state, (uint16_t) operand); */
-      /* uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1)); */
+      /* uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1); */
+      /* uint8_t low_addr = peek_mem(state, (uint16_t) operand); */
+      /* uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1)); */
 
       /* // check if page boundary was crossed and fix addresses */
       /* uint16_t base = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
@@ -3369,14 +3370,14 @@ void disass(nes_state *state, char *output) {
       /* } */
       /* uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8; */
       /* effective_addr += (uint16_t) state->cpu->registers->Y; */
-      uint8_t operand = read_mem(state, state->cpu->current_opcode_PC+1);
-      uint8_t low_addr = read_mem(state, (uint16_t) operand);
-      uint8_t high_addr = read_mem(state, (uint16_t) (operand + 1));
+      uint8_t operand = peek_mem(state, state->cpu->current_opcode_PC+1);
+      uint8_t low_addr = peek_mem(state, (uint16_t) operand);
+      uint8_t high_addr = peek_mem(state, (uint16_t) (operand + 1));
 
       uint16_t effective_addr = (uint16_t) low_addr | ((uint16_t) high_addr) << 8;
       effective_addr += (uint16_t) state->cpu->registers->Y;
 
-      uint8_t value = read_mem(state, effective_addr);
+      uint8_t value = peek_mem(state, effective_addr);
       sprintf(output, "%04X  %02X %02X    *ISB ($%02X),Y = %02X%02X @ %04X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
@@ -3393,48 +3394,48 @@ void disass(nes_state *state, char *output) {
     // SBC Zeropage, X
   case 0xF5:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     SBC $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // INC Zeropage, X
   case 0xF6:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X     INC $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *ISB Zeropage, X - Illegal instruction
   case 0xF7:
     {
-      uint16_t addr = (uint16_t) read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = (uint16_t) peek_mem(state, state->cpu->current_opcode_PC+1);
       addr += state->cpu->registers->X;
       addr &= 0xFF;
       sprintf(output, "%04X  %02X %02X    *ISB $%02X,X @ %02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      (uint8_t) addr,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -3449,8 +3450,8 @@ void disass(nes_state *state, char *output) {
   // SBC Absolute Y
   case 0xF9:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -3461,15 +3462,15 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  SBC $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              /* read_mem(state, state->cpu->current_opcode_PC+2), */
-              /* read_mem(state, state->cpu->current_opcode_PC+1), */
-              read_mem(state, addr));
+              /* peek_mem(state, state->cpu->current_opcode_PC+2), */
+              /* peek_mem(state, state->cpu->current_opcode_PC+1), */
+              peek_mem(state, addr));
       
   }
   break;
@@ -3478,8 +3479,8 @@ void disass(nes_state *state, char *output) {
   // *ISB Absolute Y
   case 0xFB:
   {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->Y) > 0xFFFF) {
 	  addr = state->cpu->registers->Y - 1;
@@ -3490,15 +3491,15 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *ISB $%02X%02X,Y @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              /* read_mem(state, state->cpu->current_opcode_PC+2), */
-              /* read_mem(state, state->cpu->current_opcode_PC+1), */
-              read_mem(state, addr));
+              /* peek_mem(state, state->cpu->current_opcode_PC+2), */
+              /* peek_mem(state, state->cpu->current_opcode_PC+1), */
+              peek_mem(state, addr));
       
   }
   break;
@@ -3507,8 +3508,8 @@ void disass(nes_state *state, char *output) {
     // SBC Absolute X
   case 0xFD:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -3519,21 +3520,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  SBC $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // INC Absolute X
   case 0xFE:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -3544,21 +3545,21 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X  INC $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
     // *ISB Absolute X
   case 0xFF:
     {
-      uint16_t addr = read_mem(state, state->cpu->current_opcode_PC+2) << 8;
-      addr |= read_mem(state, state->cpu->current_opcode_PC+1);
+      uint16_t addr = peek_mem(state, state->cpu->current_opcode_PC+2) << 8;
+      addr |= peek_mem(state, state->cpu->current_opcode_PC+1);
       // Handle wrap-around
       if (((uint32_t) addr) + ((uint32_t) state->cpu->registers->X) > 0xFFFF) {
 	  addr = state->cpu->registers->X - 1;
@@ -3569,13 +3570,13 @@ void disass(nes_state *state, char *output) {
       sprintf(output, "%04X  %02X %02X %02X *ISB $%02X%02X,X @ %02X%02X = %02X",
               state->cpu->current_opcode_PC,
               state->cpu->current_opcode,
-              read_mem(state, state->cpu->current_opcode_PC+1),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+2),
-              read_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+2),
+              peek_mem(state, state->cpu->current_opcode_PC+1),
 	      addr >> 8,
 	      addr & 0xFF,
-              read_mem(state, addr));
+              peek_mem(state, addr));
     }
     break;
 
@@ -3604,6 +3605,7 @@ void print_log(nes_state *state) {
   char part1[48];
   part1[47] = '\0';
   disass(state, part1);
+  build_status_reg(state);
   // Fill out missing parts later
   printf("%-48sA:%02X X:%02X Y:%02X P:%02X SP:%02X PPU:%3u,%3u CYC:%u\n",
          part1,
@@ -3620,9 +3622,12 @@ void print_log(nes_state *state) {
 
 void logger_log(nes_state *state)
 {
+  // Logging is disabled when no logfile has been opened (bench)
+  if (logfile == NULL) { return; }
   char part1[48];
   part1[47] = '\0';
   disass(state, part1);
+  build_status_reg(state);
   // Fill out missing parts later
   fprintf(logfile, "%-48sA:%02X X:%02X Y:%02X P:%02X SP:%02X PPU:%3u,%3u CYC:%u\n",
           part1,
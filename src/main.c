@@ -14,6 +14,12 @@
 #include "logger.h"
 #include "memory.h"
 #include "rom_loader.h"
+#include "idle_loop.h"
+#include "profiler.h"
+#include "prg_ram.h"
+#ifdef RECOMPILED
+#include "recompiled.h"
+#endif
 
 
 void run_for_n_cycles(nes_state *state, uint32_t cycles) {
@@ -21,8 +27,7 @@ void run_for_n_cycles(nes_state *state, uint32_t cycles) {
   while (count < cycles && !state->fatal_error) {
     /* for (uint32_t i = 0; i < cycles; i++) */
     /*        { */
-    step(state);
-    count++;
+    count += step_core(state, cycles - count);
   }
   if (state->fatal_error) {
     printf("Fatal error at cycle: %lu\n", state->cpu->cpu_cycle);
@@ -60,7 +65,7 @@ void print_mem(nes_state *state, uint16_t loc) {
   printf("Printing memory starting at: %04X\n", loc);
   uint8_t count = 0;
   while (count < 64) {
-    printf("%02X ", read_mem(state, loc+count));
+    printf("%02X ", peek_mem(state, loc+count));
     count++;
   }
   printf("\n");
@@ -94,7 +99,7 @@ void ndb(nes_state *state) {
       break;
     case 1:
       /* printf("stepping.\n"); */
-      step(state);
+      step_core(state, 1);
       break;
     default:
       if (cmd > 0) {
@@ -197,6 +202,36 @@ int load_rom(char *filename, unsigned char **rombuf) {
 
 
 
+// The report goes to filename, the folded stacks next to it in filename.folded
+void write_profile(nes_state *state, char *filename) {
+  FILE *report = fopen(filename, "w");
+  if (report == NULL) {
+    perror("fopen() failed");
+    return;
+  }
+  write_profile_report(state, report);
+  fclose(report);
+  char folded_name[4096];
+  snprintf(folded_name, sizeof(folded_name), "%s.folded", filename);
+  FILE *folded = fopen(folded_name, "w");
+  if (folded == NULL) {
+    perror("fopen() failed");
+    return;
+  }
+  write_folded_stacks(state, folded);
+  fclose(folded);
+}
+
+void write_mix(nes_state *state, char *filename) {
+  FILE *out = fopen(filename, "w");
+  if (out == NULL) {
+    perror("fopen() failed");
+    return;
+  }
+  write_instruction_mix(state, out);
+  fclose(out);
+}
+
 int main (int argc, char **argv) {
   int opt;
   bool interactive = true;
@@ -204,8 +239,12 @@ int main (int argc, char **argv) {
   uint32_t cycles_to_run = 0;
   uint16_t new_pc = 0xFFFD;
   bool overwrite_pc = false;
+  uint8_t core = CYCLE_CORE;
+  bool skip_idle_loops = false;
+  char *profile_file = NULL;
+  char *mix_file = NULL;
   opterr = 0;
-  while ((opt = getopt(argc, argv, "l:c:s:")) != -1) {
+  while ((opt = getopt(argc, argv, "l:c:s:p:m:fyai")) != -1) {
     switch (opt) {
     case 'l':
       printf("Filename is: %s\n", optarg);
@@ -219,10 +258,33 @@ int main (int argc, char **argv) {
       new_pc = (uint16_t) strtol(optarg, NULL, 16);
       overwrite_pc = true;
       break;
+    case 'f':
+      core = FAST_CORE;
+      break;
+    case 'y':
+      core = SYNC_CORE;
+      break;
+    case 'a':
+#ifdef RECOMPILED
+      core = RECOMPILED_CORE;
+      break;
+#else
+      fprintf(stderr, "-a needs a build with a recompiled rom, see make emu_aot\n");
+      return EXIT_FAILURE;
+#endif
+    case 'i':
+      skip_idle_loops = true;
+      break;
+    case 'p':
+      profile_file = optarg;
+      break;
+    case 'm':
+      mix_file = optarg;
+      break;
     case '?':
       if (optopt == 'c')
         fprintf (stderr, "Option -%c requires cycles as an argument.\n", optopt);
-      else if (optopt == 'l')
+      else if (optopt == 'l' || optopt == 'p' || optopt == 'm')
         fprintf (stderr, "Option -%c requires a filename as an argument.\n", optopt);
       else if (isprint (optopt))
         fprintf (stderr, "Unknown option `-%c'.\n", optopt);
@@ -234,7 +296,7 @@ int main (int argc, char **argv) {
       }
       break;
     default:
-      fprintf(stderr, "Usage: %s [-cl] [file...]\n", argv[0]);
+      fprintf(stderr, "Usage: %s [-clspm] [-f|-y|-a] [-i] [file...]\n", argv[0]);
       exit(EXIT_FAILURE);
     }
   }
@@ -252,21 +314,40 @@ int main (int argc, char **argv) {
   logger_init_logger(logfile);
 
 
-  unsigned char *rombuf;
   nes_rom *my_rom = malloc(sizeof(nes_rom));
-  int romret = load_rom2(argv[optind], &rombuf, my_rom);
+  int romret = load_rom2(argv[optind], my_rom);
   printf("rom loaded: %d\n", romret);
+  if (romret != 0) {
+    free(my_rom);
+    return EXIT_FAILURE;
+  }
   print_rom_info(my_rom);
   printf("Rom successfully loaded...\n");
+#ifdef RECOMPILED
+  if (core == RECOMPILED_CORE && !is_recompiled_from(my_rom)) {
+    fprintf(stderr, "emu_aot was recompiled from another rom\n");
+    return EXIT_FAILURE;
+  }
+#endif
   /* uint16_t rom_offset = print_header(rombuf); */
   printf("Initializing state... ");
   nes_state *state = init_state();
+  state->core = core;
+  if (skip_idle_loops) {
+    enable_idle_loop_skipping(state);
+  }
+  if (profile_file != NULL || mix_file != NULL) {
+    enable_profiler(state);
+  }
   printf("Done!\n");
   printf("Attaching rom...");
   //+offset to skip nes header and optional trainer
   /* attach_rom(state, rombuf+rom_offset); */
   attach_rom(state, my_rom);
   printf(" Done!\n");
+  if (my_rom->battery_backed) {
+    attach_save_file(state, argv[optind]);
+  }
   printf("Powering on console..");
   reset(state);
   printf("Done!\n");
@@ -286,8 +367,13 @@ int main (int argc, char **argv) {
   }
 
   logger_stop_logger();
+  if (profile_file != NULL) {
+    write_profile(state, profile_file);
+  }
+  if (mix_file != NULL) {
+    write_mix(state, mix_file);
+  }
 
   destroy_state(state);
-  free(rombuf);
   return 0;
 }
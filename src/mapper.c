@@ -0,0 +1,285 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "mapper.h"
+#include "memory.h"
+#include "interrupt.h"
+#include "ppu.h"
+
+// The cartridge boards. A board keeps its registers in the mapper struct, and maps banks
+// with map_prg_rom, map_chr and set_mirroring when they are written.
+// https://wiki.nesdev.com/w/index.php/Mapper
+
+// Bank numbers wrap around the size of the rom, like the unconnected high bits of a board.
+// Negative numbers count from the end, -1 is the last bank.
+static uint8_t *prg_bank(nes_state *state, int32_t bank, uint32_t size) {
+    uint32_t banks = state->rom->prg_rom_size * 0x4000 / size;
+    if (banks == 0) { banks = 1; }
+    if (bank < 0) { bank += banks; }
+    return state->rom->prg_rom + (bank % banks) * size;
+}
+
+static void map_prg(nes_state *state, uint16_t addr, int32_t bank, uint32_t size) {
+    map_prg_rom(state, addr, prg_bank(state, bank, size), size);
+}
+
+static void map_chr_bank(nes_state *state, uint16_t addr, uint32_t bank, uint32_t size) {
+    uint32_t chr_size = state->rom->chr_rom_size ? state->rom->chr_rom_size * 0x2000 : 0x2000;
+    uint32_t banks = chr_size / size;
+    map_chr(state, addr, state->rom->chr_rom + (bank % banks) * size, size);
+}
+
+// Mirroring from the header, for the boards where it is soldered
+static void header_mirroring(nes_state *state) {
+    if (state->rom->four_screen_VRAM) {
+        set_mirroring(state, MIRROR_FOUR_SCREEN);
+    }
+    else {
+        set_mirroring(state, state->rom->mirroring ? MIRROR_VERTICAL : MIRROR_HORIZONTAL);
+    }
+}
+
+// Mapper 0: 16 or 32kb of PRG-ROM, 16kb is mirrored at $C000. 8kb of CHR.
+static void nrom_reset(nes_state *state) {
+    map_prg(state, 0x8000, 0, 0x4000);
+    map_prg(state, 0xC000, -1, 0x4000);
+    map_chr_bank(state, 0x0000, 0, 0x2000);
+    header_mirroring(state);
+}
+
+// Mapper 2: a 16kb bank at $8000, the last bank is fixed at $C000
+static void uxrom_write(nes_state *state, uint16_t addr, uint8_t value) {
+    (void) addr;
+    map_prg(state, 0x8000, value, 0x4000);
+}
+
+// Mapper 3: PRG like NROM, the written value selects the 8kb CHR bank
+static void cnrom_write(nes_state *state, uint16_t addr, uint8_t value) {
+    (void) addr;
+    map_chr_bank(state, 0x0000, value, 0x2000);
+}
+
+// Mapper 7: 32kb banks, and one nametable for all four selected by bit 4
+static void axrom_reset(nes_state *state) {
+    map_prg(state, 0x8000, 0, 0x8000);
+    map_chr_bank(state, 0x0000, 0, 0x2000);
+    set_mirroring(state, MIRROR_SINGLE_LOW);
+}
+
+static void axrom_write(nes_state *state, uint16_t addr, uint8_t value) {
+    (void) addr;
+    map_prg(state, 0x8000, value & 7, 0x8000);
+    set_mirroring(state, value & 0x10 ? MIRROR_SINGLE_HIGH : MIRROR_SINGLE_LOW);
+}
+
+// Mapper 1, MMC1. Registers are written a bit at a time, the fifth write picks the register
+// by address: control at $8000, CHR banks at $A000 and $C000, PRG bank at $E000.
+#define MMC1_CONTROL 0
+#define MMC1_CHR0 1
+#define MMC1_CHR1 2
+#define MMC1_PRG 3
+
+static void mmc1_update(nes_state *state) {
+    mapper *m = state->mapper;
+    uint8_t control = m->registers[MMC1_CONTROL];
+    static const uint8_t mirroring[4] = { MIRROR_SINGLE_LOW, MIRROR_SINGLE_HIGH, MIRROR_VERTICAL, MIRROR_HORIZONTAL };
+    set_mirroring(state, mirroring[control & 3]);
+    // 512kb boards (SUROM) select the 256kb half with bit 4 of the CHR register
+    int32_t outer = state->rom->prg_rom_size > 16 ? (m->registers[MMC1_CHR0] & 0x10) : 0;
+    uint8_t bank = m->registers[MMC1_PRG] & 0x0F;
+    switch ((control >> 2) & 3) {
+    case 0:
+    case 1:
+        map_prg(state, 0x8000, (outer | bank) >> 1, 0x8000);
+        break;
+    case 2:
+        map_prg(state, 0x8000, outer, 0x4000);
+        map_prg(state, 0xC000, outer | bank, 0x4000);
+        break;
+    case 3:
+        map_prg(state, 0x8000, outer | bank, 0x4000);
+        map_prg(state, 0xC000, outer | 0x0F, 0x4000);
+        break;
+    }
+    if (control & 0x10) {
+        map_chr_bank(state, 0x0000, m->registers[MMC1_CHR0], 0x1000);
+        map_chr_bank(state, 0x1000, m->registers[MMC1_CHR1], 0x1000);
+    }
+    else {
+        map_chr_bank(state, 0x0000, m->registers[MMC1_CHR0] >> 1, 0x2000);
+    }
+}
+
+static void mmc1_reset(nes_state *state) {
+    mapper *m = state->mapper;
+    m->registers[MMC1_CONTROL] = 0x0C;
+    m->last_write_cycle = UINT64_MAX - 1;
+    mmc1_update(state);
+}
+
+static void mmc1_write(nes_state *state, uint16_t addr, uint8_t value) {
+    mapper *m = state->mapper;
+    // The write of a read-modify-write instruction right after its dummy write is ignored, so
+    // INC of a byte with bit 7 set only resets. The fast core does both writes in the same cycle
+    // (fast_read_modify_write), the cycle core in two (READ_EFF_ADDR_DUMMY_WRITE).
+    uint64_t cycle = state->cpu->cpu_cycle;
+    bool consecutive = cycle - m->last_write_cycle <= 1;
+    m->last_write_cycle = cycle;
+    if (consecutive) {
+        return;
+    }
+    if (value & 0x80) {
+        m->shift = 0;
+        m->shift_count = 0;
+        m->registers[MMC1_CONTROL] |= 0x0C;
+        mmc1_update(state);
+        return;
+    }
+    m->shift |= (value & 1) << m->shift_count;
+    if (++m->shift_count < 5) {
+        return;
+    }
+    m->registers[(addr >> 13) & 3] = m->shift;
+    m->shift = 0;
+    m->shift_count = 0;
+    mmc1_update(state);
+}
+
+// Mapper 4, MMC3. $8000 selects which of R0-R7 $8001 writes, and the PRG and CHR layout.
+// Two 8kb PRG banks switch, the second to last is at $C000 or $8000, the last at $E000.
+// CHR is two 2kb and four 1kb banks, with the halves swapped by bit 7 of $8000.
+static void mmc3_update(nes_state *state) {
+    mapper *m = state->mapper;
+    uint8_t *r = m->registers;
+    if (m->bank_select & 0x40) {
+        map_prg(state, 0x8000, -2, 0x2000);
+        map_prg(state, 0xC000, r[6], 0x2000);
+    }
+    else {
+        map_prg(state, 0x8000, r[6], 0x2000);
+        map_prg(state, 0xC000, -2, 0x2000);
+    }
+    map_prg(state, 0xA000, r[7], 0x2000);
+    map_prg(state, 0xE000, -1, 0x2000);
+    uint16_t invert = m->bank_select & 0x80 ? 0x1000 : 0;
+    map_chr_bank(state, 0x0000 ^ invert, r[0] >> 1, 0x800);
+    map_chr_bank(state, 0x0800 ^ invert, r[1] >> 1, 0x800);
+    map_chr_bank(state, 0x1000 ^ invert, r[2], 0x400);
+    map_chr_bank(state, 0x1400 ^ invert, r[3], 0x400);
+    map_chr_bank(state, 0x1800 ^ invert, r[4], 0x400);
+    map_chr_bank(state, 0x1C00 ^ invert, r[5], 0x400);
+}
+
+static void mmc3_reset(nes_state *state) {
+    mapper *m = state->mapper;
+    m->bank_select = 0;
+    m->registers[6] = 0;
+    m->registers[7] = 1;
+    mmc3_update(state);
+    header_mirroring(state);
+}
+
+static void mmc3_write(nes_state *state, uint16_t addr, uint8_t value) {
+    mapper *m = state->mapper;
+    switch (addr & 0xE001) {
+    case 0x8000:
+        m->bank_select = value;
+        mmc3_update(state);
+        break;
+    case 0x8001:
+        m->registers[m->bank_select & 7] = value;
+        mmc3_update(state);
+        break;
+    case 0xA000:
+        if (!state->rom->four_screen_VRAM) {
+            set_mirroring(state, value & 1 ? MIRROR_HORIZONTAL : MIRROR_VERTICAL);
+        }
+        break;
+    case 0xA001:
+        // PRG-RAM protect
+        break;
+    case 0xC000:
+        m->irq_latch = value;
+        break;
+    case 0xC001:
+        m->irq_counter = 0;
+        m->irq_reload = true;
+        break;
+    case 0xE000:
+        m->irq_enabled = false;
+        lower_irq(state, IRQ_MAPPER);
+        break;
+    case 0xE001:
+        m->irq_enabled = true;
+        break;
+    }
+}
+
+// The counter is reloaded when it is 0 (or a reload was asked for), else decremented,
+// and the IRQ is raised when it ends up at 0
+static void mmc3_scanline(nes_state *state) {
+    mapper *m = state->mapper;
+    if (m->irq_counter == 0 || m->irq_reload) {
+        m->irq_counter = m->irq_latch;
+        m->irq_reload = false;
+    }
+    else {
+        m->irq_counter--;
+    }
+    if (m->irq_counter == 0 && m->irq_enabled) {
+        raise_irq(state, IRQ_MAPPER);
+    }
+}
+
+void init_mapper(nes_state *state) {
+    free_mapper(state);
+    mapper *m = calloc(1, sizeof(mapper));
+    state->mapper = m;
+    m->reset = nrom_reset;
+    switch (state->rom->mapper) {
+    case MAPPER_NROM:
+        m->name = "NROM";
+        break;
+    case MAPPER_MMC1:
+        m->name = "MMC1";
+        m->reset = mmc1_reset;
+        m->write = mmc1_write;
+        break;
+    case MAPPER_UXROM:
+        m->name = "UxROM";
+        m->write = uxrom_write;
+        break;
+    case MAPPER_CNROM:
+        m->name = "CNROM";
+        m->write = cnrom_write;
+        break;
+    case MAPPER_MMC3:
+        m->name = "MMC3";
+        m->reset = mmc3_reset;
+        m->write = mmc3_write;
+        m->scanline = mmc3_scanline;
+        break;
+    case MAPPER_AXROM:
+        m->name = "AxROM";
+        m->reset = axrom_reset;
+        m->write = axrom_write;
+        break;
+    default:
+        fprintf(stderr, "Mapper %u is not supported\n", state->rom->mapper);
+        state->fatal_error = true;
+        state->running = false;
+        return;
+    }
+    m->reset(state);
+    schedule_a12(state);
+}
+
+void mapper_scanline(nes_state *state) {
+    if (state->mapper != NULL && state->mapper->scanline != NULL) {
+        state->mapper->scanline(state);
+    }
+}
+
+void free_mapper(nes_state *state) {
+    free(state->mapper);
+    state->mapper = NULL;
+}
@@ -1,28 +1,72 @@
 #include <stdio.h>
 #include "memory.h"
+#include "mapper.h"
+#include "decode_cache.h"
 
-uint8_t read_mem(nes_state *state, uint16_t memloc) {
+// The cpu address space in pages of 256 bytes, see memory_map in definitions.h.
+// RAM is mirrored four times at $0000-$1FFF, the PPU registers through $2000-$3FFF,
+// the APU and IO registers are at $4000-$401F and PRG-ROM is at $8000-$FFFF, mapped by the mapper.
+// PRG-RAM at $6000-$7FFF is mapped by init_prg_ram when a rom is attached (see prg_ram.c).
+// Only $4020-$5FFF is still unmapped, reads there are a fatal error and writes are ignored.
+void map_memory(nes_state *state) {
+  memory_map *map = &state->map;
+  for (uint16_t page = 0; page < 0x100; page++) {
+    map->read[page] = NULL;
+    map->write[page] = NULL;
+    map->handler[page] = BUS_OPEN;
+  }
+  for (uint16_t page = 0x00; page < 0x20; page++) {
+    map->read[page] = state->memory + ((page << 8) & 0x7FF);
+    map->write[page] = map->read[page];
+  }
+  for (uint16_t page = 0x20; page < 0x40; page++) {
+    map->handler[page] = BUS_PPU;
+  }
+  map->handler[0x40] = BUS_IO;
+  for (uint16_t page = 0x80; page < 0x100; page++) {
+    map->handler[page] = BUS_ROM;
+  }
+}
 
-  /*   8000-FFFF is the main area the cartridge ROM is mapped to in memory. Sometimes it can be bank switched, usually in 32k, 16k, or 8k sized banks. */
-  if (memloc >= 0x8000) {
-    /* return state->rom[memloc - 0xC000]; */
-    uint16_t translated = memloc - 0x8000;
-    /* printf("Memloc: %04X, translated: %04X\n", memloc, translated); */
-    if (translated < 0x4000) {
-      return state->rom->prg_rom1[translated];
-    }
-    else {
-      translated -= 0x4000;
-      return state->rom->prg_rom2[translated];
-    }
+void map_prg_rom(nes_state *state, uint16_t addr, uint8_t *bank, uint32_t size) {
+  for (uint32_t offset = 0; offset < size; offset += 0x100) {
+    state->map.read[(addr + offset) >> 8] = bank + offset;
   }
-  /*   0000-07FF is RAM*/
-  /* 0800-1FFF are mirrors of RAM (you AND the address with 07FF to get the effective address)    */
-  if (memloc < 0x1fff) {
-    return state->memory[memloc & 0x7FF];
+  invalidate_fetch_page(state);
+  remap_decode_cache(state, addr, size);
+}
+
+void map_chr(nes_state *state, uint16_t addr, uint8_t *bank, uint32_t size) {
+  for (uint32_t offset = 0; offset < size; offset += 0x400) {
+    state->ppu->pattern_tables[(addr + offset) >> 10] = bank + offset;
+  }
+}
+
+void set_mirroring(nes_state *state, uint8_t mirroring) {
+  // The 1kb nametable of ppu_vram at each of the four slots
+  static const uint8_t layouts[5][4] = {
+    [MIRROR_HORIZONTAL] = { 0, 0, 1, 1 },
+    [MIRROR_VERTICAL] = { 0, 1, 0, 1 },
+    [MIRROR_SINGLE_LOW] = { 0, 0, 0, 0 },
+    [MIRROR_SINGLE_HIGH] = { 1, 1, 1, 1 },
+    [MIRROR_FOUR_SCREEN] = { 0, 1, 2, 3 },
+  };
+  for (uint8_t i = 0; i < 4; i++) {
+    state->ppu->nametables[i] = state->ppu->ppu_vram + layouts[mirroring][i] * 0x400;
   }
+}
+
+void invalidate_fetch_page(nes_state *state) {
+  state->cpu->fetch_page = NULL;
+  state->cpu->fetch_page_base = FETCH_PAGE_INVALID;
+}
+
+uint8_t read_io(nes_state *state, uint16_t memloc) {
+  switch (state->map.handler[memloc >> 8]) {
   /*   2000-2007 is how the CPU writes to the PPU, 2008-3FFF are mirrors of that address range. */
-  if (memloc >= 0x2000 && memloc <= 0x3FFF) {
+  case BUS_PPU:
+  {
+    ppu_catch_up(state);
     printf("PPU Reg read! reg: %04X\n", memloc);
 
     uint16_t translated = memloc & 0x2007;
@@ -52,8 +96,13 @@ uint8_t read_mem(nes_state *state, uint16_t memloc) {
       break;
     }
   }
+  break;
   /*   4000-401F is for IO ports and sound */
-  if (memloc >= 0x4000 && memloc <= 0x401F) {
+  case BUS_IO:
+    if (memloc > 0x401F) {
+      break;
+    }
+    ppu_catch_up(state);
     // TODO - implement reading APU IO
     switch(memloc) {
       // Actually APU IO pulse 2[0]
@@ -86,6 +135,7 @@ uint8_t read_mem(nes_state *state, uint16_t memloc) {
 	return 0xFF;
 	break;
     }
+    break;
   }
 
   /*   4020-4FFF is rarely used, but can be used by some cartridges */
@@ -109,77 +159,79 @@ uint8_t read_mem(nes_state *state, uint16_t memloc) {
 }
 
 
-void write_mem(nes_state *state, uint16_t memloc, uint8_t value) {
+void write_io(nes_state *state, uint16_t memloc, uint8_t value) {
+  switch (state->map.handler[memloc >> 8]) {
   /*   8000-FFFF is the main area the cartridge ROM is mapped to in memory. Sometimes it can be bank switched, usually in 32k, 16k, or 8k sized banks. */
-    /* __asm__("int3"); */
-  // Writing to rom is not possible, signal fatal error
-  if (memloc >= 0x8000) {
+  // Writes go to the registers of the mapper, a board without any can't be written
+  case BUS_ROM:
+    if (state->mapper != NULL && state->mapper->write != NULL) {
+      // The scanlines the ppu is behind are counted before the board's registers change
+      ppu_catch_up(state);
+      state->mapper->write(state, memloc, value);
+      return;
+    }
     state->fatal_error = true;
     state->running = false;
     return;
-  }
-  /*   0000-07FF is RAM*/
-  /* 0800-1FFF are mirrors of RAM (you AND the address with 07FF to get the effective address)    */
-  if (memloc < 0x1fff) {
-    state->memory[memloc & 0x7FF] = value;
-    return;
-  }
   /*   2000-2007 is how the CPU writes to the PPU, 2008-3FFF are mirrors of that address range. */
   // Writing to any PPU IO port will fill the "latch" with that value
-  if (memloc >= 0x2000 && memloc <= 0x3FFF) {
+  case BUS_PPU:
+  {
+    ppu_catch_up(state);
     printf("PPU Reg write! reg: %04X\n", memloc);
-    // TODO - replace with writing to PPU IO regs
-    if (memloc >= 0x2000 && memloc <= 0x3FFF) {
-      uint16_t translated = memloc & 0x2007;
-      switch (translated) {
-      case 0x2000:
-        state->ppu->registers->ppu_ctrl = value;
-        break;
-      case 0x2001:
-        state->ppu->registers->ppu_mask = value;
-        break;
-      case 0x2002:
-        // Read-only, just fill the latch
-        break;
-      case 0x2003:
-        state->ppu->registers->oam_addr = value;
-        break;
-      case 0x2004:
-        state->ppu->registers->oam_data = value;
-        break;
-      case 0x2005:
-        state->ppu->registers->ppu_scroll = value;
-        break;
-      case 0x2006:
+    uint16_t translated = memloc & 0x2007;
+    switch (translated) {
+    case 0x2000:
+      write_ctrl_reg(state, value);
+      break;
+    case 0x2001:
+      write_mask_reg(state, value);
+      break;
+    case 0x2002:
+      // Read-only, just fill the latch
+      break;
+    case 0x2003:
+      state->ppu->registers->oam_addr = value;
+      break;
+    case 0x2004:
+      state->ppu->registers->oam_data = value;
+      break;
+    case 0x2005:
+      state->ppu->registers->ppu_scroll = value;
+      break;
+    case 0x2006:
 	  /* __asm__("int3"); */
-        if (state->ppu->high_pointer) {
-          state->ppu->internal_addr_reg &= 0xff;
-          state->ppu->internal_addr_reg |= ((uint16_t) value << 8);
-        }
-        else {
-          state->ppu->internal_addr_reg &= 0xff00;
-          state->ppu->internal_addr_reg |= (uint16_t) value;
-        }
-        state->ppu->high_pointer = !state->ppu->high_pointer;
-        break;
-
-      case 0x2007:
-        state->ppu->registers->ppu_data = value;
-        break;
+      if (state->ppu->high_pointer) {
+        state->ppu->internal_addr_reg &= 0xff;
+        state->ppu->internal_addr_reg |= ((uint16_t) value << 8);
       }
-      // Writing to any PPU IO port will fill the latch/bus
-      state->ppu->address_latch = value;
+      else {
+        state->ppu->internal_addr_reg &= 0xff00;
+        state->ppu->internal_addr_reg |= (uint16_t) value;
+      }
+      state->ppu->high_pointer = !state->ppu->high_pointer;
+      break;
 
+    case 0x2007:
+      state->ppu->registers->ppu_data = value;
+      break;
     }
-    return;
+    // Writing to any PPU IO port will fill the latch/bus
+    state->ppu->address_latch = value;
   }
+  return;
   /*   4000-401F is for IO ports and sound */
-  if (memloc >= 0x4000 && memloc <= 0x401f) {
+  case BUS_IO:
+    if (memloc > 0x401F) {
+      return;
+    }
+    ppu_catch_up(state);
     // TODO - implement writing to APU IO
     switch(memloc) {
     case 0x4014:
       state->ppu->registers->oam_dma = value;
       state->ppu->address_latch = value;
+      oam_dma(state, value);
       break;
     }
     return;
@@ -187,9 +239,38 @@ void write_mem(nes_state *state, uint16_t memloc, uint8_t value) {
   /*   4020-4FFF is rarely used, but can be used by some cartridges */
   /*   5000-5FFF is rarely used, but can be used by some cartridges, often as bank switching registers, not actual memory, but some cartridges put RAM there */
   /*   6000-7FFF is often cartridge WRAM. Since emulators usually emulate this whether it actually exists in the cartridge or not, there's a little bit of controversy about NES headers not adequately representing a cartridge. */
+}
 
 
-
+// What read_io would return, without its side effects: no register changes, no catching up
+// the ppu and no output. Unmapped addresses read as 0 instead of being a fatal error.
+uint8_t peek_io(nes_state *state, uint16_t memloc) {
+  switch (state->map.handler[memloc >> 8]) {
+  case BUS_PPU:
+    switch (memloc & 0x2007) {
+    case 0x2002:
+      return peek_status_reg(state);
+    case 0x2004:
+      return state->ppu->oam_memory[state->ppu->registers->oam_addr];
+    case 0x2007:
+      return peek_data_reg(state);
+    default:
+      return state->ppu->address_latch;
+    }
+  case BUS_IO:
+    switch (memloc) {
+    case 0x4004:
+    case 0x4005:
+    case 0x4006:
+    case 0x4007:
+    case 0x4015:
+      return 0xFF;
+    case 0x4014:
+      return state->ppu->registers->oam_dma;
+    }
+    break;
+  }
+  return 0;
 }
 
 
@@ -209,16 +290,12 @@ uint8_t read_mem_ppu(nes_state *state, uint16_t memloc) {
 
   /* $0000-1FFF is normally mapped by the cartridge to a CHR-ROM or CHR-RAM, often with a bank switching mechanism. */
   if (memloc <= 0x1FFF) {
-    return state->rom->chr_rom[memloc];
+    return state->ppu->pattern_tables[memloc >> 10][memloc & 0x3FF];
   }
   /* $2000-2FFF is normally mapped to the 2kB NES internal VRAM, providing 2 nametables with a mirroring configuration controlled by the cartridge, but it can be partly or fully remapped to RAM on the cartridge, allowing up to 4 simultaneous nametables. */
-  if (memloc <= 0x2FFF) {
-    return state->ppu->ppu_vram[memloc - 0x2000];
-  }
   /* $3000-3EFF is usually a mirror of the 2kB region from $2000-2EFF. The PPU does not render from this address range, so this space has negligible utility. */
-  // Mirrored VRAM
   if (memloc <= 0x3EFF) {
-    return state->ppu->ppu_vram[memloc - 0x3000];
+    return state->ppu->nametables[(memloc >> 10) & 3][memloc & 0x3FF];
   }
 
   /* $3F00-3FFF is not configurable, always mapped to the internal palette control. */
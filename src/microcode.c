@@ -0,0 +1,1912 @@
+#include "cpu.h"
+#include "microcode.h"
+
+// Every opcode as a fixed program of actions.
+// Built once at compile time, so starting an instruction is a single lookup in this table.
+// Opcodes missing from the table are not implemented yet (length 0).
+
+const microcode_program unknown_program = { .length = 1, .actions = { FETCH_OPCODE_INC_PC } };
+
+// NMI and IRQ. The instruction at the handler follows it, see cpu_step.
+const microcode_program interrupt_program = {
+    .length = 7,
+    .actions = {
+        /*  1    PC     R  fetch opcode (and discard it - $00 (BRK) is forced into the opcode register instead) */
+        STALL_CYCLE,
+        /*  2    PC     R  read next instruction byte (actually the same as above, since PC increment is suppressed. Also discarded.) */
+        STALL_CYCLE,
+        /*  3  $0100,S  W  push PCH on stack, decrement S */
+        PUSH_PCH_DEC_S,
+        /*  4  $0100,S  W  push PCL on stack, decrement S */
+        PUSH_PCL_DEC_S,
+        /*  5  $0100,S  W  push P on stack (with B flag *clear*), decrement S */
+        PUSH_STATUS_REG_DEC_S_CLEAR_B_FLAG,
+        /*  6   A       R  fetch PCL (A = FFFE for IRQ, A = FFFA for NMI), set I flag */
+        INTERRUPT_FETCH_PCL,
+        /*  7   A       R  fetch PCH (A = FFFF for IRQ, A = FFFB for NMI) */
+        INTERRUPT_FETCH_PCH } };
+
+const microcode_program microcode[256] = {
+    // BRK
+    [0x00] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     PUSH_PCH_DEC_S,
+                     PUSH_PCL_DEC_S,
+                     PUSH_STATUS_REG_DEC_S_SET_B_FLAG,
+                     BRK_FETCH_PCL,
+                     BRK_FETCH_PCH } },
+
+    // ORA indexed indirect, X
+    [0x01] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *SLO indexed indirect, X - Illegal instruction
+    [0x03] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // *NOP Zeropage - illegal opcode
+    [0x04] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0x44] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0x64] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_PC } },
+
+    // ORA Zero page
+    [0x05] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ORA_MEMORY } },
+
+    // ASL Zeropage
+    [0x06] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     ASL_ZEROPAGE } },
+
+    // *SLO Zeropage - Illegal instruction
+    [0x07] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // PHP - Push Processor Status on stack
+    [0x08] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     PUSH_STATUS_REG_DEC_SP } },
+
+    // ORA immediate
+    [0x09] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     ORA_IMM_INC_PC } },
+
+    // ASL A
+    [0x0A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     ASL_ACC } },
+
+    // *NOP Absolute - illegal opcode
+    [0x0C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_PC,
+                     INC_PC } },
+
+    // ORA Absolute
+    [0x0D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     ORA_MEMORY } },
+
+    // ASL Absolute
+    [0x0E] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ASL_MEMORY } },
+
+    // *SLO Absolute
+    [0x0F] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // BPL - Branch Result Plus
+    [0x10] = { .length = 3, .branch_mask = NEGATIVE_FLAG, .branch_value = 0,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // ORA indirect-indexed, Y
+    [0x11] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     ORA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *SLO indirect-indexed, Y - Illegal instruction
+    [0x13] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+                     FIX_HIGH_BYTE_NO_WRITE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // *NOP zeropage, X - illegal opcode
+    [0x14] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0x34] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0x54] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0x74] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0xD4] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     INC_PC } },
+    [0xF4] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     INC_PC } },
+
+    // ORA zeropage, X
+    [0x15] = { .length = 4, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     ORA_MEMORY } },
+
+    // ASL zero page, X
+    [0x16] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ASL_MEMORY } },
+
+    // *SLO zero page, X - Illegal instruction
+    [0x17] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // CLC
+    [0x18] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     CLEAR_CARRY_FLAG } },
+
+    // ORA absolute, Y
+    [0x19] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     ORA_MEMORY } },
+
+    // *NOP Implied - illegal opcode
+    [0x1A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+    [0x3A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+    [0x5A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+    [0x7A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+    [0xDA] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+    [0xFA] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+
+    // *SLO absolute, Y - Illegal instruction
+    [0x1B] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // *NOP Absolute, X - "illegal instruction"
+    [0x1C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     NOP_ABSOLUTE_X_MAYBE_STALL } },
+    [0x3C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     NOP_ABSOLUTE_X_MAYBE_STALL } },
+    [0x5C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     NOP_ABSOLUTE_X_MAYBE_STALL } },
+    [0x7C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     NOP_ABSOLUTE_X_MAYBE_STALL } },
+    [0xDC] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     NOP_ABSOLUTE_X_MAYBE_STALL } },
+    [0xFC] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     NOP_ABSOLUTE_X_MAYBE_STALL } },
+
+    // ORA absolute, X
+    [0x1D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     ORA_MEMORY } },
+
+    // ASL absolute, X
+    [0x1E] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ASL_MEMORY } },
+
+    // *SLO absolute, X - Illegal instruction
+    [0x1F] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SLO_DO_ASL_THEN_ORA } },
+
+    // JSR
+    [0x20] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     PUSH_PCH_DEC_S,
+                     PUSH_PCL_DEC_S,
+                     COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH } },
+
+    // AND indexed indirect
+    [0x21] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     AND_MEMORY } },
+
+    // *RLA indexed indirect - Illegal instruction
+    [0x23] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // BIT zero page
+    [0x24] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     BIT_READ_AFFECT_FLAGS } },
+
+    // AND zeropage
+    [0x25] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     AND_MEMORY } },
+
+    // ROL Zeropage
+    [0x26] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     ROL_ZEROPAGE } },
+
+    // *RLA Zeropage
+    [0x27] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // PLP - Pull Process Register (flags) from stack
+    [0x28] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_SP,
+                     PULL_STATUS_REG_FROM_STACK_PLP } },
+
+    // AND immediate
+    [0x29] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     AND_IMM_INC_PC } },
+
+    // ROL A
+    [0x2A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     ROL_ACC } },
+
+    // BIT Absolute
+    [0x2C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     BIT_READ_AFFECT_FLAGS } },
+
+    // AND Absolute
+    [0x2D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     AND_MEMORY } },
+
+    // ROL Absolute
+    [0x2E] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ROL_MEMORY } },
+
+    // *RLA Absolute - Illegal instruction
+    [0x2F] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // BMI - Branch Result Minus
+    [0x30] = { .length = 3, .branch_mask = NEGATIVE_FLAG | ZERO_FLAG, .branch_value = NEGATIVE_FLAG,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // AND indirect-indexed, Y
+    [0x31] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     AND_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *RLA indirect-indexed, Y - Illegal instruction
+    [0x33] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+                     FIX_HIGH_BYTE_NO_WRITE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // AND zeropage, X
+    [0x35] = { .length = 4, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     AND_MEMORY } },
+
+    // ROL zero page, X
+    [0x36] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ROL_MEMORY } },
+
+    // *RLA zero page, X - Illegal instruction
+    [0x37] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // SEC - set carry flag
+    [0x38] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     SET_CARRY_FLAG } },
+
+    // AND absolute, Y
+    [0x39] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     AND_MEMORY } },
+
+    // *RLA absolute, Y
+    [0x3B] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // AND absolute, X
+    [0x3D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     AND_MEMORY } },
+
+    // ROL absolute, X
+    [0x3E] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ROL_MEMORY } },
+
+    // *RLA absolute, X
+    [0x3F] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RLA_DO_ROL_THEN_AND } },
+
+    // RTI - Return from interrupt
+    [0x40] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_SP,
+                     PULL_STATUS_REG_FROM_STACK_RTI,
+                     PULL_PCL_FROM_STACK_INC_SP,
+                     PULL_PCH_FROM_STACK } },
+
+    // EOR indexed indirect
+    [0x41] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     EOR_MEMORY } },
+
+    // *SRE indexed indirect, X - Illegal instruction
+    [0x43] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // EOR zeropage
+    [0x45] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     EOR_MEMORY } },
+
+    // LSR Zeropage
+    [0x46] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     LSR_ZEROPAGE } },
+
+    // *SRE Zeropage
+    [0x47] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // PHA - Push ACC to stack
+    [0x48] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     PUSH_ACC_DEC_SP } },
+
+    // EOR immediate
+    [0x49] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     EOR_IMM_INC_PC } },
+
+    // LSR A - Logical Shift Right accumulator
+    [0x4A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     LSR_ACC } },
+
+    // JMP immediate
+    [0x4C] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     COPY_LOW_ADDR_BYTE_TO_PCL_FETCH_HIGH_ADDR_BYTE_TO_PCH } },
+
+    // EOR Absolute
+    [0x4D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     EOR_MEMORY } },
+
+    // LSR Absolute
+    [0x4E] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     LSR_MEMORY } },
+
+    // *SRE Absolute - Illegal instruction
+    [0x4F] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // BVC - Branch Overflow clear
+    [0x50] = { .length = 3, .branch_mask = OVERFLOW_FLAG, .branch_value = 0,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // EOR indirect-indexed, Y
+    [0x51] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     EOR_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *SRE indirect-indexed, Y
+    [0x53] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+                     FIX_HIGH_BYTE_NO_WRITE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // EOR zeropage, X
+    [0x55] = { .length = 4, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     EOR_MEMORY } },
+
+    // LSR zero page, X
+    [0x56] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     LSR_MEMORY } },
+
+    // *SRE zero page, X
+    [0x57] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // EOR absolute, Y
+    [0x59] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     EOR_MEMORY } },
+
+    // *SRE absolute, Y - Illegal instruction
+    [0x5B] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // EOR absolute, X
+    [0x5D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     EOR_MEMORY } },
+
+    // LSR absolute, X
+    [0x5E] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     LSR_MEMORY } },
+
+    // *SRE absolute, X - Illegal instruction
+    [0x5F] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     SRE_DO_LSR_THEN_EOR_ACC } },
+
+    // RTS - Return from subroutine
+    [0x60] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_SP,
+                     PULL_PCL_FROM_STACK_INC_SP,
+                     PULL_PCH_FROM_STACK,
+                     INC_PC } },
+
+    // ADC indexed indirect
+    [0x61] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     ADC_MEMORY } },
+
+    // *RRA indexed indirect - Illegal instruction
+    [0x63] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // ADC zeropage
+    [0x65] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ADC_MEMORY } },
+
+    // ROR Zeropage
+    [0x66] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     ROR_ZEROPAGE } },
+
+    // *RRA Zeropage
+    [0x67] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // PLA - Pull Accumulator from stack
+    [0x68] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE,
+                     INC_SP,
+                     PULL_ACC_FROM_STACK_AFFECT_FLAGS } },
+
+    // ADC Immediate
+    [0x69] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     ADC_IMM_INC_PC } },
+
+    // ROR A
+    [0x6A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     ROR_ACC } },
+
+    // JMP Absolute indirect
+    [0x6C] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     FETCH_LOW_ADDR_TO_LATCH,
+                     FETCH_PCH_COPY_LATCH_TO_PCL } },
+
+    // ADC Absolute
+    [0x6D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     ADC_MEMORY } },
+
+    // ROR Absolute
+    [0x6E] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ROR_MEMORY } },
+
+    // *RRA Absolute
+    [0x6F] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // BVS - Branch Overflow Set
+    [0x70] = { .length = 3, .branch_mask = OVERFLOW_FLAG, .branch_value = OVERFLOW_FLAG,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // ADC indirect-indexed, Y
+    [0x71] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     ADC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *RRA indirect-indexed, Y
+    [0x73] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+                     FIX_HIGH_BYTE_NO_WRITE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // ADC zeropage, X
+    [0x75] = { .length = 4, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     ADC_MEMORY } },
+
+    // ROR zero page, X
+    [0x76] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ROR_MEMORY } },
+
+    // *RRA zero page, X
+    [0x77] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // SEI - Set Interrupt Flag
+    [0x78] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     SET_INTERRUPT_FLAG } },
+
+    // ADC absolute, Y
+    [0x79] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     ADC_MEMORY } },
+
+    // *RRA absolute, Y - Illegal instruction
+    [0x7B] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // ADC absolute, X
+    [0x7D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     ADC_MEMORY } },
+
+    // ROR absolute, X
+    [0x7E] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ROR_MEMORY } },
+
+    // *RRA absolute, X - Illegal instruction
+    [0x7F] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     RRA_DO_ROR_THEN_ADC } },
+
+    // *NOP Immediate - illegal opcode
+    [0x80] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC } },
+    [0x82] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC } },
+    [0x89] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC } },
+    [0xC2] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC } },
+    [0xE2] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC } },
+
+    // STA indirect, X (indexed indirect)
+    [0x81] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE } },
+
+    // *SAX indirect, X (indexed indirect) - Illegal instruction, ACC AND X -> Memory
+    [0x83] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS } },
+
+    // STY Zeropage
+    [0x84] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     WRITE_Y_TO_EFF_ADDR_ZEROPAGE } },
+
+    // STA Zeropage
+    [0x85] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     WRITE_ACC_TO_EFF_ADDR_ZEROPAGE } },
+
+    // STX Zeropage
+    [0x86] = { .length = 3,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     WRITE_X_TO_EFF_ADDR_ZEROPAGE } },
+
+    // *SAX Zeropage - Illegal instruction
+    [0x87] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS } },
+
+    // DEC - Decrement Y register
+    [0x88] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     DEC_Y } },
+
+    // TXA
+    [0x8A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     COPY_X_TO_ACC_AFFECT_NZ_FLAGS } },
+
+    // STY Absolute
+    [0x8C] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     WRITE_Y_TO_EFF_ADDR_NON_ZEROPAGE } },
+
+    // STA Absolute
+    [0x8D] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE } },
+
+    // STX Absolute
+    [0x8E] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     WRITE_X_TO_EFF_ADDR_NON_ZEROPAGE } },
+
+    // *SAX Absolute - Illegal instruction
+    [0x8F] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS } },
+
+    // BCC - Branch Carry Clear
+    [0x90] = { .length = 3, .branch_mask = CARRY_FLAG, .branch_value = 0,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // STA indirect-indexed, Y
+    [0x91] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     STALL_CYCLE,
+                     STA_STX_STY_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // STY zero page, X
+    [0x94] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     WRITE_Y_TO_EFF_ADDR_ZEROPAGE } },
+
+    // STA zero page, X
+    [0x95] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     WRITE_ACC_TO_EFF_ADDR_ZEROPAGE } },
+
+    // STX zero page, Y
+    [0x96] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_Y,
+                     WRITE_X_TO_EFF_ADDR_ZEROPAGE } },
+
+    // *SAX zero page, Y - Illegal instruction
+    [0x97] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_Y,
+                     SAX_PERFORM_AND_THEN_WRITE_EFF_ADDR_NO_AFFECT_FLAGS } },
+
+    // TYA
+    [0x98] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     COPY_Y_TO_ACC_AFFECT_NZ_FLAGS } },
+
+    // STA absolute, Y
+    [0x99] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+                     WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE } },
+
+    // TXS - Transfer X to Stack Pointer, affect no flags
+    [0x9A] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     COPY_X_TO_SP_NO_FLAGS } },
+
+    // STA Absolute, X
+    [0x9D] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STA_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE,
+                     WRITE_ACC_TO_EFF_ADDR_NON_ZEROPAGE } },
+
+    // LDY Immediate
+    [0xA0] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_VALUE_SAVE_TO_Y } },
+
+    // LDA indirect,x
+    [0xA1] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     READ_EFF_ADDR_STORE_IN_ACC_AFFECT_NZ_FLAGS } },
+
+    // LDX Immediate
+    [0xA2] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_VALUE_SAVE_TO_X } },
+
+    // LAX indirect,x - illegal, combines LDA and LDX
+    [0xA3] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS } },
+
+    // LDY Zero page
+    [0xA4] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     READ_ZEROPAGE_STORE_IN_Y_AFFECT_NZ_FLAGS } },
+
+    // LDA Zero page
+    [0xA5] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     READ_ZEROPAGE_STORE_IN_ACC_AFFECT_NZ_FLAGS } },
+
+    // LDX Zero page
+    [0xA6] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     READ_ZEROPAGE_STORE_IN_X_AFFECT_NZ_FLAGS } },
+
+    // *LAX Zero page - illegal instruction
+    [0xA7] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS } },
+
+    // TAY
+    [0xA8] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     COPY_ACC_TO_Y_AFFECT_NZ_FLAGS } },
+
+    // LDA Immediate
+    [0xA9] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_VALUE_SAVE_TO_ACC } },
+
+    // TAX
+    [0xAA] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     COPY_ACC_TO_X_AFFECT_NZ_FLAGS } },
+
+    // LDY Absolute
+    [0xAC] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     READ_EFF_ADDR_STORE_IN_Y_AFFECT_NZ_FLAGS } },
+
+    // LDA Absolute
+    [0xAD] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     READ_EFF_ADDR_STORE_IN_ACC_AFFECT_NZ_FLAGS } },
+
+    // LDX Absolute
+    [0xAE] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     READ_EFF_ADDR_STORE_IN_X_AFFECT_NZ_FLAGS } },
+
+    // *LAX Absolute - Illegal opcode
+    [0xAF] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS } },
+
+    // BCS
+    [0xB0] = { .length = 3, .branch_mask = CARRY_FLAG, .branch_value = CARRY_FLAG,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // LDA indirect-indexed, Y
+    [0xB1] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_ACC } },
+
+    // *LAX indirect-indexed, Y - Illegal instruction
+    [0xB3] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y,
+                     LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS } },
+
+    // LDY zero page, X
+    [0xB4] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     READ_ZEROPAGE_STORE_IN_Y_AFFECT_NZ_FLAGS } },
+
+    // LDA zero page, X
+    [0xB5] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     READ_ZEROPAGE_STORE_IN_ACC_AFFECT_NZ_FLAGS } },
+
+    // LDX zero page, Y
+    [0xB6] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_Y,
+                     READ_ZEROPAGE_STORE_IN_X_AFFECT_NZ_FLAGS } },
+
+    // *LAX zero page, Y - Illegal instruction
+    [0xB7] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_Y,
+                     LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS } },
+
+    // CLV - Clear Overflow Flag
+    [0xB8] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     CLEAR_OVERFLOW_FLAG } },
+
+    // LDA Indexed Absolute Y
+    [0xB9] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_ACC } },
+
+    // TSX - Transfer SP to X
+    [0xBA] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     COPY_SP_TO_X_AFFECT_NZ_FLAGS } },
+
+    // LDY Indexed Absolute X
+    [0xBC] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     READ_FROM_EFF_ADDR_FIX_HIGH_BYTE_TO_Y } },
+
+    // LDA absolute, X
+    [0xBD] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     READ_EFF_ADDR_STORE_IN_ACC_AFFECT_NZ_FLAGS } },
+
+    // LDX absolute, Y
+    [0xBE] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     READ_EFF_ADDR_STORE_IN_X_AFFECT_NZ_FLAGS } },
+
+    // *LAX absolute, Y - Illegal instruction
+    [0xBF] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     LAX_READ_EFF_ADDR_STORE_IN_REGS_AFFECT_NZ_FLAGS } },
+
+    // CPY Immediate
+    [0xC0] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     CPY_IMM_INC_PC } },
+
+    // CMP indexed indirect
+    [0xC1] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     CMP_MEMORY } },
+
+    // *DCP indexed indirect, X - Illegal instruction
+    [0xC3] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // CPY zeropage
+    [0xC4] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     CPY_MEMORY } },
+
+    // CMP zeropage
+    [0xC5] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     CMP_MEMORY } },
+
+    // DEC Zeropage
+    [0xC6] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DEC_MEMORY } },
+
+    // *DCP Zeropage - Illegal instruction
+    [0xC7] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // INY - Increment Y register
+    [0xC8] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_Y } },
+
+    // CMP Acc immediate
+    [0xC9] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     CMP_IMM_INC_PC } },
+
+    // DEX - Decrement X register
+    [0xCA] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     DEC_X } },
+
+    // CPY Absolute
+    [0xCC] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     CPY_MEMORY } },
+
+    // CMP Absolute
+    [0xCD] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     CMP_MEMORY } },
+
+    // DEC Absolute
+    [0xCE] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DEC_MEMORY } },
+
+    // *DCP Absolute - Illegal instruction
+    [0xCF] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // BNE
+    [0xD0] = { .length = 3, .branch_mask = ZERO_FLAG, .branch_value = 0,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // CMP indirect-indexed, Y
+    [0xD1] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     CMP_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *DCP indirect-indexed, Y
+    [0xD3] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+                     FIX_HIGH_BYTE_NO_WRITE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // CMP zeropage, X
+    [0xD5] = { .length = 4, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     CMP_MEMORY } },
+
+    // DEC zero page, X
+    [0xD6] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DEC_MEMORY } },
+
+    // *DCP zero page, X - Illegal instruction
+    [0xD7] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // CLD - Clear Decimal Flag
+    [0xD8] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     CLEAR_DECIMAL_FLAG } },
+
+    // CMP absolute, Y
+    [0xD9] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     CMP_MEMORY } },
+
+    // *DCP absolute, Y - Illegal instruction
+    [0xDB] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // CMP absolute, X
+    [0xDD] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     CMP_MEMORY } },
+
+    // DEC absolute, X
+    [0xDE] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DEC_MEMORY } },
+
+    // *DCP absolute, X - Illegal instruction
+    [0xDF] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     DCP_PERFORM_DEC_MEMORY_THEN_CMP_MEMORY } },
+
+    // CPX Immediate
+    [0xE0] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     CPX_IMM_INC_PC } },
+
+    // SBC indexed indirect
+    [0xE1] = { .length = 6, .clear_high_addr_byte = true, .clear_low_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     SBC_MEMORY } },
+
+    // *ISB indexed indirect, X - Illegal instruction
+    [0xE3] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     READ_ADDR_ADD_X_STORE_IN_OPERAND,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_EFF_ADDR_HIGH,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+
+    // CPX zeropage
+    [0xE4] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     CPX_MEMORY } },
+
+    // SBC zeropage
+    [0xE5] = { .length = 3, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     SBC_MEMORY } },
+
+    // INC Zeropage
+    [0xE6] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     INC_MEMORY } },
+
+    // *ISB Zeropage - Illegal instruction
+    [0xE7] = { .length = 5, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+
+    // INX - Increment X register
+    [0xE8] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     INC_X } },
+
+    // SBC Immediate
+    [0xE9] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     SBC_IMM_INC_PC } },
+
+    // NOP
+    [0xEA] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     STALL_CYCLE } },
+
+    // SBC Immediate (Illegal opcode)
+    [0xEB] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     SBC_IMM_INC_PC } },
+
+    // CPX Absolute
+    [0xEC] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     CPX_MEMORY } },
+
+    // SBC Absolute
+    [0xED] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     SBC_MEMORY } },
+
+    // INC Absolute
+    [0xEE] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     INC_MEMORY } },
+
+    // *ISB Absolute - Illegal instruction
+    [0xEF] = { .length = 6,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_HIGH_ADDR_BYTE_INC_PC,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+
+    // BEQ
+    [0xF0] = { .length = 3, .branch_mask = ZERO_FLAG, .branch_value = ZERO_FLAG,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_OPERAND_INC_PC,
+                     ADD_OPERAND_TO_PCL } },
+
+    // SBC indirect-indexed, Y
+    [0xF1] = { .length = 5,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y,
+                     SBC_READ_FROM_EFF_ADDR_FIX_HIGH_BYTE } },
+
+    // *ISB indirect-indexed, Y - Illegal instruction
+    [0xF3] = { .length = 8,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_ZP_PTR_ADDR_INC_PC,
+                     FETCH_EFF_ADDR_LOW,
+                     FETCH_HIGH_BYTE_ADDR_ADD_Y_NO_EXTRA_CYCLE,
+                     FIX_HIGH_BYTE_NO_WRITE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+
+    // SBC zeropage, X
+    [0xF5] = { .length = 4, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     SBC_MEMORY } },
+
+    // INC zero page, X
+    [0xF6] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     INC_MEMORY } },
+
+    // *ISB zero page, X - Illegal instruction
+    [0xF7] = { .length = 6, .clear_high_addr_byte = true,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     ZEROPAGE_ADD_X,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+
+    // SED - Set Decimal Flag
+    [0xF8] = { .length = 2,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     SET_DECIMAL_FLAG } },
+
+    // SBC absolute, Y
+    [0xF9] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC,
+                     SBC_MEMORY } },
+
+    // *ISB absolute, Y - Illegal instruction
+    [0xFB] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_Y_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+
+    // SBC absolute, X
+    [0xFD] = { .length = 4,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC,
+                     SBC_MEMORY } },
+
+    // INC absolute, X
+    [0xFE] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     INC_MEMORY } },
+
+    // *ISB absolute, X - Illegal instruction
+    [0xFF] = { .length = 7,
+               .actions = {
+                     FETCH_OPCODE_INC_PC,
+                     FETCH_LOW_ADDR_BYTE_INC_PC,
+                     FETCH_EFF_ADDR_HIGH_ADD_X_INC_PC_NO_EXTRA_CYCLES,
+                     STALL_CYCLE,
+                     STALL_CYCLE,
+                     READ_EFF_ADDR_DUMMY_WRITE,
+                     ISB_PERFORM_INC_MEMORY_THEN_SBC_MEMORY } },
+};
@@ -3,6 +3,16 @@
 #include "memory.h"
 #include "rom_loader.h"
 #include "ppu.h"
+#include "cpu_fast.h"
+#include "decode_cache.h"
+#include "idle_loop.h"
+#include "interrupt.h"
+#include "mapper.h"
+#include "prg_ram.h"
+#include "profiler.h"
+#ifdef RECOMPILED
+#include "recompiled.h"
+#endif
 
 void step(nes_state *state) {
   // Update the master clock by one
@@ -13,15 +23,91 @@ void step(nes_state *state) {
   }
   // Log if needed
   // Step one cycle in CPU
-  if (state->cpu->next_action == state->cpu->end_of_queue) {
+  if (is_instruction_done(state)) {
     state->cpu->current_opcode_PC = state->cpu->registers->PC;
-    state->cpu->current_opcode = read_mem(state, state->cpu->registers->PC);
+    state->cpu->current_opcode = decode_instruction(state, state->cpu->registers->PC)->opcode;
     logger_log(state);
+    profile_boundary(state);
   }
   cpu_step(state);
 
 }
 
+// Step a whole instruction with the fast core. Returns the number of cpu cycles used.
+// The log is written at the same ppu dot as in step(), after the first cpu cycle of the instruction.
+uint16_t step_instruction(nes_state *state) {
+  ppu_run(state, 3);
+  state->cpu->current_opcode_PC = state->cpu->registers->PC;
+  state->cpu->current_opcode = decode_instruction(state, state->cpu->registers->PC)->opcode;
+  logger_log(state);
+  profile_boundary(state);
+  uint16_t cycles = cpu_fast_step(state);
+  state->master_clock += cycles;
+  ppu_run(state, 3 * (cycles - 1));
+  poll_interrupt_lines(state);
+  return cycles;
+}
+
+// Run the cycle core's program for one whole instruction. The ppu is not stepped every
+// cycle, the dots are only counted, and run when the cpu touches an io register
+// (see read_mem and write_mem), before the last cycle or when the instruction is done.
+// The actions before the last one run back to back (execute_program_actions), the last
+// cycle and the extra cycles after the program go through cpu_step, which polls the
+// interrupt lines. Logs at the same ppu dot as step(). Returns the number of cpu cycles used.
+uint32_t step_synced(nes_state *state) {
+  cpu_state *cpu = state->cpu;
+  uint32_t cycles = 0;
+  do {
+    state->master_clock += 1;
+    state->ppu->pending_dots += 3;
+    if (is_instruction_done(state)) {
+      ppu_catch_up(state);
+      cpu->current_opcode_PC = cpu->registers->PC;
+      cpu->current_opcode = decode_instruction(state, cpu->registers->PC)->opcode;
+      logger_log(state);
+      profile_boundary(state);
+      start_instruction(state);
+    }
+    if (cpu->next_action + 1 < cpu->program_length) {
+      uint8_t count = cpu->program_length - 1 - cpu->next_action;
+      execute_program_actions(state, count);
+      cycles += count;
+      continue;
+    }
+    // The interrupt lines are polled in the last cycle, the ppu must have raised NMI by then
+    ppu_catch_up(state);
+    cpu_step(state);
+    cycles++;
+  } while (!is_instruction_done(state) && !state->fatal_error);
+  ppu_catch_up(state);
+  return cycles;
+}
+
+// Step the selected core. Returns the number of cpu cycles run,
+// the cycle core runs exactly one, the others at least one whole instruction.
+// When idle loops are skipped, this can be many iterations of the loop at PC instead.
+uint32_t step_core(nes_state *state, uint32_t budget) {
+  if (state->idle_loop != NULL && (state->core != CYCLE_CORE || is_instruction_done(state))) {
+    uint32_t skipped = skip_idle_loop(state, budget);
+    if (skipped > 0) {
+      return skipped;
+    }
+  }
+  switch (state->core) {
+  case FAST_CORE:
+    return step_instruction(state);
+  case SYNC_CORE:
+    return step_synced(state);
+#ifdef RECOMPILED
+  case RECOMPILED_CORE:
+    return step_recompiled(state, budget);
+#endif
+  default:
+    step(state);
+    return 1;
+  }
+}
+
 nes_state* init_state() {
   // Create the state and allocate memory
   nes_state *state = malloc(sizeof(nes_state));
@@ -32,20 +118,41 @@ nes_state* init_state() {
   init_registers(regs);
   state->cpu = cpu;
   state->cpu->registers = regs;
+  state->cpu->program = NULL;
+  state->cpu->program_length = 0;
   state->cpu->next_action = 0;
-  state->cpu->end_of_queue = 0;
+  state->cpu->in_interrupt = false;
+  state->cpu->interrupt_lines = 0;
+  state->cpu->nmi_line = false;
+  state->cpu->interrupt_vector = 0;
+  state->cpu->polled_interrupt = 0;
+  invalidate_fetch_page(state);
+  state->cpu->stall_cycles = 0;
+  state->cpu->oam_dma_align = false;
+  state->cpu->lazy_flags = 0;
   // Set up memory (malloc)
-  state->memory = malloc(2048); // 2kb ram (at least for now)
+  state->memory = calloc(2048, 1); // 2kb ram (at least for now)
+  state->rom = NULL;
+  map_memory(state);
   state->running = true;
   state->fatal_error = false;
+  state->core = CYCLE_CORE;
+  state->decode_cache = NULL;
+  state->idle_loop = NULL;
+  state->profiler = NULL;
+  state->mapper = NULL;
+  state->prg_ram = NULL;
   // PPU init
   ppu_state *ppu = malloc(sizeof(ppu_state));
-  ppu_registers *ppu_regs = malloc(sizeof(ppu_registers));
+  ppu_registers *ppu_regs = calloc(1, sizeof(ppu_registers));
   ppu->registers = ppu_regs;
-  ppu->ppu_vram = malloc(0x800); // 2kb vram
+  ppu->ppu_vram = malloc(0x1000); // 2kb vram, 4kb with four screen boards
   ppu->chr_rom = malloc(0x2000); //8kb for chr_rom
   ppu->oam_memory = malloc(0x100); // 256 bytes OAM memory
   state->ppu = ppu;
+  // Until a rom is attached
+  map_chr(state, 0x0000, ppu->chr_rom, 0x2000);
+  set_mirroring(state, MIRROR_HORIZONTAL);
   state->ppu->ppu_cycle = 0;
   state->ppu->ppu_scanline = 0;
   state->ppu->ppu_frame = 0;
@@ -53,6 +160,10 @@ nes_state* init_state() {
   state->ppu->high_pointer = true;
   state->ppu->internal_addr_reg = 0;
   state->ppu->nmi_occurred = false;
+  state->ppu->pending_dots = 0;
+  state->ppu->a12_cycle = A12_NONE;
+  state->ppu->a12_exact = false;
+  state->ppu->a12_low = 0;
   return state;
 }
 
@@ -67,6 +178,11 @@ void destroy_state(nes_state *state) {
   free(state->ppu->oam_memory);
   free(state->ppu);
   free_rom(state->rom);
+  free_decode_cache(state);
+  free_idle_loop(state);
+  free_profiler(state);
+  free_mapper(state);
+  free_prg_ram(state);
   free(state);
 }
 
@@ -108,6 +224,10 @@ void reset(nes_state *state) {
 
 void attach_rom(nes_state *state, nes_rom *rom) {
   state->rom = rom;
+  map_memory(state);
+  init_prg_ram(state);
+  init_mapper(state);
+  flush_decode_cache(state);
 }
 
 void print_state(nes_state *state) {
@@ -115,5 +235,4 @@ void print_state(nes_state *state) {
   print_regs(state);
   print_cpu_status(state);
   print_stack(state);
-  printf("Addr_dest: %p\tAddr_source: %p\tAddr_X: %p\n", (state->cpu->destination_reg), (state->cpu->source_reg), &(state->cpu->registers->X));
 }
@@ -1,7 +1,10 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "ppu.h"
 #include "memory.h"
+#include "interrupt.h"
+#include "mapper.h"
 
 void incr_addr_reg(nes_state *state) {
   // If bit 2 is set, add 32
@@ -13,14 +16,50 @@ void incr_addr_reg(nes_state *state) {
     state->ppu->internal_addr_reg += 1;
   }
 }
+// The ppu pulls NMI while the VBlank flag and the NMI enable bit of $2000 are both set
+void update_nmi_line(nes_state *state) {
+  set_nmi_line(state, (state->ppu->registers->ppu_status & state->ppu->registers->ppu_ctrl & 128) != 0);
+}
+
+// Enabling NMI during VBlank raises the line, and gives another NMI
+void write_ctrl_reg(nes_state *state, uint8_t value) {
+  uint8_t changed = state->ppu->registers->ppu_ctrl ^ value;
+  if (changed & 0x38) {
+    a12_settings_changed(state);
+  }
+  state->ppu->registers->ppu_ctrl = value;
+  update_nmi_line(state);
+  if (changed & 0x38) {
+    schedule_a12(state);
+  }
+}
+
+void write_mask_reg(nes_state *state, uint8_t value) {
+  bool rendering_changed = ((state->ppu->registers->ppu_mask & 0x18) != 0) != ((value & 0x18) != 0);
+  if (rendering_changed) {
+    a12_settings_changed(state);
+  }
+  state->ppu->registers->ppu_mask = value;
+  if (rendering_changed) {
+    schedule_a12(state);
+  }
+}
+
 // See: https://wiki.nesdev.com/w/index.php/PPU_registers#Data_.28.242007.29_.3C.3E_read.2Fwrite
-uint8_t read_status_reg(nes_state *state) {
+// The value a read of $2002 returns, without clearing VBlank and the latch
+uint8_t peek_status_reg(nes_state *state) {
   uint8_t return_val = state->ppu->registers->ppu_status;
   // The 4 LSB of status-reg are unused. A read will return the 4 LSB of the latch.
   return_val &= 0xf0;
-  return_val |= (state->ppu->address_latch & 0xf);;
+  return_val |= (state->ppu->address_latch & 0xf);
+  return return_val;
+}
+
+uint8_t read_status_reg(nes_state *state) {
+  uint8_t return_val = peek_status_reg(state);
   // Clear bit 7 of status reg
   state->ppu->registers->ppu_status &= 0x7f;
+  update_nmi_line(state);
   // And clear the "internal buffer"
   state->ppu->address_latch = 0;
   return return_val;
@@ -34,6 +73,37 @@ uint8_t read_oam_data_reg(nes_state *state) {
   return return_val;
 
 }
+// The value a read of $2007 returns, without refilling the buffer or incrementing the address
+uint8_t peek_data_reg(nes_state *state) {
+  uint16_t addr = state->ppu->internal_addr_reg;
+  if (addr < 0x3f00) {
+    return state->ppu->address_latch;
+  }
+  if (addr <= 0x3fff) {
+    return read_mem_ppu(state, addr);
+  }
+  return 0;
+}
+
+// A write of page to $4014 copies $xx00-$xxFF to OAM, as 256 writes to $2004 starting at OAM_ADDR,
+// while the cpu is halted. The copy is done at once, the cpu gets the cycles as stall cycles.
+void oam_dma(nes_state *state, uint8_t page) {
+  uint8_t *oam = state->ppu->oam_memory;
+  uint8_t start = state->ppu->registers->oam_addr;
+  const uint8_t *source = state->map.read[page];
+  if (source != NULL) {
+    memcpy(oam + start, source, 0x100 - start);
+    memcpy(oam, source + 0x100 - start, start);
+  }
+  else {
+    for (uint16_t i = 0; i < 0x100; i++) {
+      oam[(uint8_t) (start + i)] = read_mem(state, (uint16_t) page << 8 | i);
+    }
+  }
+  state->cpu->stall_cycles += OAM_DMA_CYCLES;
+  state->cpu->oam_dma_align = true;
+}
+
 uint8_t read_data_reg(nes_state *state) {
   // Save the "old latch" if needed
   uint16_t addr = state->ppu->internal_addr_reg;
@@ -62,6 +132,138 @@ uint8_t read_data_reg(nes_state *state) {
   return return_val;
 }
 
+// PPU A12 is bit 12 of the address the ppu fetches from, set when it reads the pattern table at $1000.
+// Its rises clock the scanline counter of MMC3, which ignores a rise unless A12 was low for a few dots.
+// The rendered scanlines (and the pre-render one) all fetch in the same order, 8 dots per tile:
+// nametable and attribute bytes (A12 low) and then the two pattern bytes, from the background table
+// (bit 4 of $2000) at dots 1-256 and 321-336, and from the sprite table (bit 3) at dots 257-320.
+// So the dot of the rise only depends on $2000 and $2001, and is predicted by schedule_a12.
+// When they change while the ppu renders, A12 is followed dot by dot until the frame is done.
+#define A12_FILTER_DOTS 9 // Three cpu cycles
+
+static bool rendered_scanline(uint16_t scanline) {
+  return scanline <= 239 || scanline == 261;
+}
+
+// The background fetches of the pre-render scanline raise A12 at dot 4 after vblank
+static bool prerender_a12(nes_state *state) {
+  return (state->ppu->registers->ppu_ctrl & 0x10) && (state->ppu->registers->ppu_mask & 0x18) &&
+    !state->ppu->a12_exact && state->mapper != NULL && state->mapper->scanline != NULL;
+}
+
+__attribute__((noinline)) static void prerender_dot(nes_state *state) {
+  if (prerender_a12(state)) {
+    mapper_scanline(state);
+  }
+}
+
+// A12 at a dot, for the given $2000 and $2001. 8x16 sprites are taken to be at $1000,
+// where the slots without a sprite fetch tile $FF from. Dot 0 of the rendered lines puts
+// the address of the next background fetch on the bus, the pre-render one follows vblank.
+static bool a12_at(uint8_t ctrl, uint8_t mask, uint16_t scanline, uint16_t cycle) {
+  if (!(mask & 0x18) || !rendered_scanline(scanline)) {
+    return false;
+  }
+  if (cycle == 0) {
+    return scanline != 261 && (ctrl & 0x10);
+  }
+  uint8_t fetch = (cycle - 1) & 7;
+  if (cycle > 336 || fetch < 3 || fetch == 7) {
+    return false;
+  }
+  return (cycle > 256 && cycle <= 320) ? (ctrl & 0x28) != 0 : (ctrl & 0x10) != 0;
+}
+
+// The dot A12 rises at on every rendered scanline with the current settings: at the first sprite
+// pattern fetch with only sprites at $1000, at the first fetch for the next scanline with only the
+// background there. With both at $1000 A12 is only low for long enough in vblank.
+void schedule_a12(nes_state *state) {
+  ppu_state *ppu = state->ppu;
+  uint8_t ctrl = ppu->registers->ppu_ctrl;
+  if (ppu->a12_exact) {
+    return;
+  }
+  ppu->a12_cycle = A12_NONE;
+  if (state->mapper == NULL || state->mapper->scanline == NULL || !(ppu->registers->ppu_mask & 0x18)) {
+    return;
+  }
+  if ((ctrl & 0x10) && !(ctrl & 0x28)) {
+    ppu->a12_cycle = 324;
+  }
+  else if (!(ctrl & 0x10) && (ctrl & 0x28)) {
+    ppu->a12_cycle = 260;
+  }
+}
+
+// Follow A12 from the dot cycle on. Dot 340 is always low, and counted with the one before it,
+// ppu_step only sees the end of a dot before the scanline changes (see ppu_step).
+static void follow_a12_from(ppu_state *ppu, uint16_t cycle) {
+  if (cycle == 340) {
+    if (ppu->a12_low < A12_FILTER_DOTS) {
+      ppu->a12_low++;
+    }
+    cycle = 0;
+  }
+  ppu->a12_cycle = cycle;
+}
+
+// Before $2000 or $2001 changes A12: in a rendered scanline the predicted dots of the old and new
+// settings could both be wrong for this frame, so A12 is followed from here on, starting with
+// how long it has been low with the old settings.
+void a12_settings_changed(nes_state *state) {
+  ppu_state *ppu = state->ppu;
+  if (state->mapper == NULL || state->mapper->scanline == NULL || ppu->a12_exact || !rendered_scanline(ppu->ppu_scanline)) {
+    return;
+  }
+  uint16_t scanline = ppu->ppu_scanline;
+  uint16_t cycle = ppu->ppu_cycle;
+  uint8_t low = 0;
+  while (low < A12_FILTER_DOTS) {
+    if (cycle == 0) {
+      cycle = 340;
+      scanline = scanline == 0 ? 261 : scanline - 1;
+    }
+    else {
+      cycle--;
+    }
+    if (a12_at(ppu->registers->ppu_ctrl, ppu->registers->ppu_mask, scanline, cycle)) {
+      break;
+    }
+    low++;
+  }
+  ppu->a12_low = low;
+  ppu->a12_exact = true;
+  follow_a12_from(ppu, ppu->ppu_cycle);
+}
+
+// Called after the dot a12_cycle of every scanline. Not inlined, ppu_step stays as cheap as without it.
+__attribute__((noinline)) static void a12_dot(nes_state *state) {
+  ppu_state *ppu = state->ppu;
+  uint16_t scanline = ppu->ppu_scanline;
+  uint16_t cycle = ppu->ppu_cycle - 1;
+  if (!ppu->a12_exact) {
+    if (rendered_scanline(scanline)) {
+      mapper_scanline(state);
+    }
+    return;
+  }
+  if (a12_at(ppu->registers->ppu_ctrl, ppu->registers->ppu_mask, scanline, cycle)) {
+    if (ppu->a12_low >= A12_FILTER_DOTS) {
+      mapper_scanline(state);
+    }
+    ppu->a12_low = 0;
+  }
+  else if (ppu->a12_low < A12_FILTER_DOTS) {
+    ppu->a12_low++;
+  }
+  follow_a12_from(ppu, cycle + 1);
+  // The frame is rendered, the next one starts out predicted again
+  if (scanline == 240) {
+    ppu->a12_exact = false;
+    schedule_a12(state);
+  }
+}
+
 // Do one step of the ppu
 void ppu_step(nes_state *state) {
   // Scanlines 0-239 are all "similar"
@@ -131,8 +333,11 @@ void ppu_step(nes_state *state) {
 /* The VBlank flag of the PPU is set at tick 1 (the second tick) of scanline 241, where the VBlank NMI also occurs. The PPU makes no memory accesses during these scanlines, so PPU memory can be freely accessed by the program.  */	
     case 241:
       // Set Vblank flag
+      if (cycle == 1) {
 	printf("Setting vblank at scanline 241\n");
 	state->ppu->registers->ppu_status |= 128;
+	update_nmi_line(state);
+      }
       break;
       // Last scanline! Lots of stuff happens
       // cycle 1 (0-indexed) - clear VBlank, sprite 0, Overflow
@@ -141,8 +346,12 @@ void ppu_step(nes_state *state) {
 	if (cycle == 1) {
 	    // Clear VBLANK, sprite 0 and overflow - three highest bits
 	    state->ppu->registers->ppu_status &= 0x1f;
+	    update_nmi_line(state);
 
 	}
+	else if (cycle == 4) {
+	  prerender_dot(state);
+	}
       break ;
       // Nothing happens
     default: break;
@@ -158,4 +367,65 @@ void ppu_step(nes_state *state) {
     state->ppu->ppu_scanline = 0;
 
   }
+  // After the dot, so the call is a jump and doesn't cost the other dots anything
+  if (state->ppu->ppu_cycle == state->ppu->a12_cycle + 1) {
+    a12_dot(state);
+  }
+}
+
+// Step the ppu a number of dots, used by the fast cpu core after a whole instruction
+void ppu_run(nes_state *state, uint16_t dots) {
+  for (uint16_t i = 0; i < dots; i++) {
+    ppu_step(state);
+  }
+}
+
+// Run the dots the synced core has left behind, so the ppu is where the cpu is
+void ppu_catch_up(nes_state *state) {
+  uint32_t dots = state->ppu->pending_dots;
+  state->ppu->pending_dots = 0;
+  for (uint32_t i = 0; i < dots; i++) {
+    ppu_step(state);
+  }
+}
+
+#define DOTS_PER_SCANLINE 341
+#define DOTS_PER_FRAME (262 * DOTS_PER_SCANLINE)
+
+static uint32_t dots_until(uint32_t from, uint32_t to) {
+  return (to + DOTS_PER_FRAME - from) % DOTS_PER_FRAME;
+}
+
+// Dots until ppu_step next changes the status register (and the NMI line): the VBlank flag
+// is set at dot 1 of scanline 241 and cleared at dot 1 of scanline 261.
+// A predicted rise of PPU A12 is one too, while A12 is followed dot by dot every dot is.
+uint32_t ppu_dots_to_next_event(nes_state *state) {
+  ppu_state *ppu = state->ppu;
+  if (ppu->a12_exact) {
+    return 0;
+  }
+  uint32_t dot = ppu->ppu_scanline * DOTS_PER_SCANLINE + ppu->ppu_cycle;
+  uint32_t vblank = dots_until(dot, 241 * DOTS_PER_SCANLINE + 1);
+  uint32_t clear = dots_until(dot, 261 * DOTS_PER_SCANLINE + 1);
+  uint32_t next = vblank < clear ? vblank : clear;
+  if (ppu->a12_cycle != A12_NONE) {
+    uint32_t scanline = ppu->ppu_scanline + (ppu->ppu_cycle > ppu->a12_cycle ? 1 : 0);
+    if (scanline > 261) { scanline = 0; }
+    if (scanline > 239) { scanline = 261; }
+    uint32_t rise = dots_until(dot, scanline * DOTS_PER_SCANLINE + ppu->a12_cycle);
+    if (rise < next) { next = rise; }
+  }
+  if (prerender_a12(state)) {
+    uint32_t rise = dots_until(dot, 261 * DOTS_PER_SCANLINE + 4);
+    if (rise < next) { next = rise; }
+  }
+  return next;
+}
+
+// Move the ppu forward without stepping it, for fewer dots than ppu_dots_to_next_event
+void ppu_skip(nes_state *state, uint32_t dots) {
+  uint32_t dot = state->ppu->ppu_scanline * DOTS_PER_SCANLINE + state->ppu->ppu_cycle;
+  dot = (dot + dots) % DOTS_PER_FRAME;
+  state->ppu->ppu_scanline = dot / DOTS_PER_SCANLINE;
+  state->ppu->ppu_cycle = dot % DOTS_PER_SCANLINE;
 }
@@ -0,0 +1,101 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "prg_ram.h"
+#include "memory.h"
+
+#define PRG_RAM_PAGES 0x20 // $6000-$7FFF
+
+// Point the pages of $6000-$7FFF at the RAM, for reads and writes
+static void map_prg_ram(nes_state *state) {
+    prg_ram *ram = state->prg_ram;
+    for (uint8_t page = 0; page < PRG_RAM_PAGES; page++) {
+        uint8_t *host = ram->memory + page * 0x100;
+        state->map.read[0x60 + page] = host;
+        state->map.write[0x60 + page] = host;
+    }
+}
+
+void init_prg_ram(nes_state *state) {
+    free_prg_ram(state);
+    prg_ram *ram = calloc(1, sizeof(prg_ram));
+    // A header without the size has 8kb
+    uint8_t banks = state->rom->prg_ram_size ? state->rom->prg_ram_size : 1;
+    ram->size = banks * 0x2000;
+    ram->memory = calloc(ram->size, 1);
+    state->prg_ram = ram;
+    map_prg_ram(state);
+    invalidate_fetch_page(state);
+}
+
+// game.nes saves to game.sav, a name without an extension gets one
+static char *save_filename(const char *rom_filename) {
+    size_t length = strlen(rom_filename);
+    const char *dot = strrchr(rom_filename, '.');
+    const char *slash = strrchr(rom_filename, '/');
+    if (dot != NULL && (slash == NULL || dot > slash)) {
+        length = dot - rom_filename;
+    }
+    char *filename = malloc(length + 5);
+    memcpy(filename, rom_filename, length);
+    strcpy(filename + length, ".sav");
+    return filename;
+}
+
+bool attach_save_file(nes_state *state, const char *rom_filename) {
+    prg_ram *ram = state->prg_ram;
+    if (ram == NULL) {
+        return false;
+    }
+    char *filename = save_filename(rom_filename);
+    int fd = open(filename, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        perror("open() of the save file failed");
+        free(filename);
+        return false;
+    }
+    struct stat savestat;
+    // A new (or short) file is grown to the size of the RAM, the new part reads as zeroes
+    if (fstat(fd, &savestat) != 0 || (savestat.st_size < ram->size && ftruncate(fd, ram->size) != 0)) {
+        perror("Sizing the save file failed");
+        close(fd);
+        free(filename);
+        return false;
+    }
+    uint8_t *memory = mmap(NULL, ram->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    // The mapping keeps the file open
+    close(fd);
+    if (memory == MAP_FAILED) {
+        perror("mmap() of the save file failed");
+        free(filename);
+        return false;
+    }
+    printf("Saving to %s\n", filename);
+    free(filename);
+    free(ram->memory);
+    ram->memory = memory;
+    ram->file_backed = true;
+    map_prg_ram(state);
+    invalidate_fetch_page(state);
+    return true;
+}
+
+void free_prg_ram(nes_state *state) {
+    prg_ram *ram = state->prg_ram;
+    if (ram == NULL) {
+        return;
+    }
+    // The kernel still writes the dirty pages of a shared mapping to the file after munmap
+    if (ram->file_backed) {
+        munmap(ram->memory, ram->size);
+    }
+    else {
+        free(ram->memory);
+    }
+    free(ram);
+    state->prg_ram = NULL;
+}
@@ -0,0 +1,339 @@
+#include <stdlib.h>
+#include "profiler.h"
+#include "memory.h"
+#include "decode_cache.h"
+
+// Guest profiler. Every instruction boundary adds the cycles since the last one to the
+// instruction that ran, in the flat per PC arrays, and to the routine on top of a call
+// stack followed through JSR/RTS (and interrupts, BRK and RTI).
+// Code that calls through a pushed address and RTS (jump tables) shows up as a return.
+// The cycles of an instruction beyond the base cycles of its opcode are a page crossing,
+// or a taken branch (and a page crossing), which gives the instruction mix.
+
+#define ROUTINES_SHOWN 32
+#define PCS_SHOWN 32
+
+// 16kb PRG-ROM bank mapped at pc, -1 outside PRG-ROM
+static int32_t prg_bank(nes_state *state, uint16_t pc) {
+    if (pc < 0x8000) {
+        return -1;
+    }
+    // The 16kb bank of PRG-ROM the mapper has at pc
+    const uint8_t *page = state->map.read[pc >> 8];
+    if (page == NULL) {
+        return -1;
+    }
+    return (page - state->rom->prg_rom) / 0x4000;
+}
+
+static uint32_t add_node(profiler *p, uint16_t entry, uint32_t parent) {
+    if (p->node_count == p->node_capacity) {
+        p->node_capacity *= 2;
+        p->nodes = realloc(p->nodes, p->node_capacity * sizeof(profile_node));
+    }
+    uint32_t index = p->node_count++;
+    profile_node *node = &p->nodes[index];
+    node->entry = entry;
+    node->parent = parent;
+    node->first_child = 0;
+    node->next_sibling = 0;
+    node->calls = 0;
+    node->cycles = 0;
+    return index;
+}
+
+// Enter entry from the current routine. Node 0 is never a child, so 0 ends the sibling lists.
+static void push_frame(profiler *p, uint16_t entry) {
+    if (p->depth == MAX_PROFILE_DEPTH) {
+        return;
+    }
+    p->depth++;
+    uint32_t child = p->nodes[p->current].first_child;
+    while (child != 0 && p->nodes[child].entry != entry) {
+        child = p->nodes[child].next_sibling;
+    }
+    if (child == 0) {
+        child = add_node(p, entry, p->current);
+        p->nodes[child].next_sibling = p->nodes[p->current].first_child;
+        p->nodes[p->current].first_child = child;
+    }
+    p->nodes[child].calls++;
+    p->current = child;
+}
+
+static void pop_frame(profiler *p) {
+    if (p->depth == 0) {
+        return;
+    }
+    p->depth--;
+    p->current = p->nodes[p->current].parent;
+}
+
+static void count(profiler *p, nes_state *state, uint16_t pc, int64_t instructions, uint64_t cycles) {
+    p->instructions[pc] += instructions;
+    p->cycles[pc] += cycles;
+    int32_t bank = prg_bank(state, pc);
+    if (bank >= 0) {
+        p->bank_instructions[bank] += instructions;
+        p->bank_cycles[bank] += cycles;
+    }
+}
+
+// The instruction at the last boundary ran in cycles
+static void count_mix(profiler *p, uint64_t cycles) {
+    uint8_t opcode = p->last_opcode;
+    p->opcode_count[opcode]++;
+    p->opcode_cycles[opcode] += cycles;
+    uint64_t extra = cycles > p->last_base_cycles ? cycles - p->last_base_cycles : 0;
+    // A write to $4014 halts the cpu for the OAM DMA, that is not a page crossing
+    if (extra >= OAM_DMA_CYCLES) { extra = 0; }
+    if (p->last_mode == MODE_RELATIVE) {
+        // More than 2 extra cycles are idle loop iterations skipped after the branch (-i)
+        if (extra > 0) { p->branches_taken[opcode]++; }
+        if (extra == 2) { p->page_crossings[opcode]++; }
+    }
+    else if (extra > 0) {
+        p->page_crossings[opcode]++;
+    }
+}
+
+void profile_instruction(nes_state *state) {
+    profiler *p = state->profiler;
+    uint16_t pc = state->cpu->current_opcode_PC;
+    if (!p->started) {
+        p->started = true;
+        p->nodes[0].entry = pc;
+    }
+    else {
+        uint64_t cycles = state->cpu->cpu_cycle - p->last_cycle;
+        if (p->pending_interrupt != 0) {
+            // The instruction at the last boundary didn't run, it was interrupted.
+            // The sequence and the first instruction of the handler did.
+            uint16_t vector = p->pending_interrupt;
+            p->pending_interrupt = 0;
+            count(p, state, p->last_pc, -1, 0);
+            push_frame(p, vector);
+            uint16_t handler = peek_mem(state, vector) | (peek_mem(state, vector + 1) << 8);
+            count(p, state, handler, 1, cycles);
+            p->nodes[p->current].cycles += cycles;
+        }
+        else {
+            count(p, state, p->last_pc, 0, cycles);
+            p->nodes[p->current].cycles += cycles;
+            count_mix(p, cycles);
+            switch (p->last_opcode) {
+            case 0x20: // JSR
+                push_frame(p, pc);
+                break;
+            case 0x00: // BRK
+                push_frame(p, PROFILE_IRQ_FRAME);
+                break;
+            case 0x60: // RTS
+            case 0x40: // RTI
+                pop_frame(p);
+                break;
+            }
+        }
+    }
+    count(p, state, pc, 1, 0);
+    // The cores have just decoded it for the log, so this is a cache hit in PRG-ROM
+    const decoded_instruction *d = decode_instruction(state, pc);
+    p->last_pc = pc;
+    p->last_opcode = state->cpu->current_opcode;
+    p->last_mode = d->mode;
+    p->last_base_cycles = d->cycles;
+    p->last_cycle = state->cpu->cpu_cycle;
+}
+
+void profile_interrupt(nes_state *state, uint16_t vector) {
+    if (state->profiler != NULL) {
+        state->profiler->pending_interrupt = vector;
+    }
+}
+
+void enable_profiler(nes_state *state) {
+    if (state->profiler != NULL) {
+        return;
+    }
+    profiler *p = calloc(1, sizeof(profiler));
+    p->node_capacity = 256;
+    p->nodes = malloc(p->node_capacity * sizeof(profile_node));
+    add_node(p, 0, 0);
+    state->profiler = p;
+}
+
+void free_profiler(nes_state *state) {
+    if (state->profiler != NULL) {
+        free(state->profiler->nodes);
+        free(state->profiler);
+        state->profiler = NULL;
+    }
+}
+
+static const char *frame_name(char name[8], uint16_t entry) {
+    if (entry == PROFILE_NMI_FRAME) {
+        return "NMI";
+    }
+    if (entry == PROFILE_IRQ_FRAME) {
+        return "IRQ";
+    }
+    snprintf(name, 8, "$%04X", entry);
+    return name;
+}
+
+// Is there another frame of the same routine further up (recursion)?
+static bool is_nested(profiler *p, uint32_t node) {
+    for (uint32_t up = node; up != 0; ) {
+        up = p->nodes[up].parent;
+        if (p->nodes[up].entry == p->nodes[node].entry) {
+            return true;
+        }
+    }
+    return false;
+}
+
+typedef struct ROUTINE {
+    uint16_t entry;
+    uint64_t self;
+    uint64_t total;
+    uint64_t calls;
+} routine;
+
+static int by_total(const void *a, const void *b) {
+    const routine *ra = a, *rb = b;
+    return ra->total < rb->total ? 1 : ra->total > rb->total ? -1 : 0;
+}
+
+typedef struct HOT_PC {
+    uint16_t pc;
+    uint64_t cycles;
+} hot_pc;
+
+static int by_cycles(const void *a, const void *b) {
+    const hot_pc *pa = a, *pb = b;
+    return pa->cycles < pb->cycles ? 1 : pa->cycles > pb->cycles ? -1 : 0;
+}
+
+void write_profile_report(nes_state *state, FILE *out) {
+    profiler *p = state->profiler;
+    uint64_t all_cycles = 0, all_instructions = 0;
+    for (uint32_t pc = 0; pc < 0x10000; pc++) {
+        all_cycles += p->cycles[pc];
+        all_instructions += p->instructions[pc];
+    }
+    if (all_cycles == 0) {
+        fprintf(out, "Nothing profiled\n");
+        return;
+    }
+    fprintf(out, "Profiled %lu instructions, %lu cycles\n\n", all_instructions, all_cycles);
+
+    // Cycles including everything called, every routine counted once per stack
+    uint64_t *subtree = calloc(p->node_count, sizeof(uint64_t));
+    for (uint32_t i = p->node_count - 1; i > 0; i--) {
+        subtree[i] += p->nodes[i].cycles;
+        subtree[p->nodes[i].parent] += subtree[i];
+    }
+    subtree[0] += p->nodes[0].cycles;
+    routine *routines = calloc(0x10000, sizeof(routine));
+    for (uint32_t i = 0; i < p->node_count; i++) {
+        routine *r = &routines[p->nodes[i].entry];
+        r->entry = p->nodes[i].entry;
+        r->self += p->nodes[i].cycles;
+        r->calls += p->nodes[i].calls;
+        if (!is_nested(p, i)) {
+            r->total += subtree[i];
+        }
+    }
+    qsort(routines, 0x10000, sizeof(routine), by_total);
+    fprintf(out, "Routines by cycles including callees:\n");
+    fprintf(out, "  %-5s %12s %7s %12s %7s %10s\n", "entry", "total", "%", "self", "%", "calls");
+    char name[8];
+    for (uint32_t i = 0; i < ROUTINES_SHOWN && routines[i].total > 0; i++) {
+        routine *r = &routines[i];
+        fprintf(out, "  %-5s %12lu %6.2f%% %12lu %6.2f%% %10lu\n", frame_name(name, r->entry),
+                r->total, 100.0 * r->total / all_cycles, r->self, 100.0 * r->self / all_cycles, r->calls);
+    }
+    free(routines);
+    free(subtree);
+
+    hot_pc *pcs = malloc(0x10000 * sizeof(hot_pc));
+    for (uint32_t pc = 0; pc < 0x10000; pc++) {
+        pcs[pc].pc = pc;
+        pcs[pc].cycles = p->cycles[pc];
+    }
+    qsort(pcs, 0x10000, sizeof(hot_pc), by_cycles);
+    fprintf(out, "\nInstructions by cycles:\n");
+    fprintf(out, "  %-5s %12s %7s %12s\n", "pc", "cycles", "%", "count");
+    for (uint32_t i = 0; i < PCS_SHOWN && pcs[i].cycles > 0; i++) {
+        uint16_t pc = pcs[i].pc;
+        fprintf(out, "  $%04X %12lu %6.2f%% %12lu\n", pc, p->cycles[pc], 100.0 * p->cycles[pc] / all_cycles, p->instructions[pc]);
+    }
+    free(pcs);
+
+    fprintf(out, "\nBanks (16kb of PRG-ROM):\n");
+    uint64_t rom_cycles = 0;
+    for (uint32_t bank = 0; bank < MAX_PROFILE_BANKS; bank++) {
+        if (p->bank_instructions[bank] == 0) { continue; }
+        rom_cycles += p->bank_cycles[bank];
+        fprintf(out, "  %3u %12lu cycles %6.2f%% %12lu instructions\n", bank, p->bank_cycles[bank],
+                100.0 * p->bank_cycles[bank] / all_cycles, p->bank_instructions[bank]);
+    }
+    fprintf(out, "  RAM %12lu cycles %6.2f%% (and anything else outside PRG-ROM)\n", all_cycles - rom_cycles, 100.0 * (all_cycles - rom_cycles) / all_cycles);
+}
+
+void write_folded_stacks(nes_state *state, FILE *out) {
+    profiler *p = state->profiler;
+    uint32_t stack[MAX_PROFILE_DEPTH + 1];
+    for (uint32_t i = 0; i < p->node_count; i++) {
+        if (p->nodes[i].cycles == 0) { continue; }
+        uint32_t depth = 0;
+        for (uint32_t node = i; ; node = p->nodes[node].parent) {
+            stack[depth++] = node;
+            if (node == 0) { break; }
+        }
+        char name[8];
+        while (depth > 0) {
+            fprintf(out, "%s", frame_name(name, p->nodes[stack[--depth]].entry));
+            fprintf(out, depth > 0 ? ";" : " ");
+        }
+        fprintf(out, "%lu\n", p->nodes[i].cycles);
+    }
+}
+
+static const char *mode_names[] = {
+    [MODE_IMPLIED] = "implied",
+    [MODE_IMMEDIATE] = "#imm",
+    [MODE_ZEROPAGE] = "zp",
+    [MODE_ZEROPAGE_X] = "zp,X",
+    [MODE_ZEROPAGE_Y] = "zp,Y",
+    [MODE_ABSOLUTE] = "abs",
+    [MODE_ABSOLUTE_X] = "abs,X",
+    [MODE_ABSOLUTE_Y] = "abs,Y",
+    [MODE_RELATIVE] = "relative",
+    [MODE_INDEXED_INDIRECT] = "(zp,X)",
+    [MODE_INDIRECT_INDEXED] = "(zp),Y",
+    [MODE_INDIRECT] = "(abs)"
+};
+
+// One line per opcode that ran, then one per addressing mode, so runs over many roms can be summed up
+void write_instruction_mix(nes_state *state, FILE *out) {
+    profiler *p = state->profiler;
+    uint64_t mode_count[MODE_INDIRECT + 1] = { 0 }, mode_cycles[MODE_INDIRECT + 1] = { 0 };
+    uint64_t mode_crossings[MODE_INDIRECT + 1] = { 0 }, mode_taken[MODE_INDIRECT + 1] = { 0 };
+    fprintf(out, "kind\tkey\tmode\tcount\tcycles\tpage_crossings\tbranches_taken\n");
+    for (uint32_t opcode = 0; opcode < 256; opcode++) {
+        if (p->opcode_count[opcode] == 0) { continue; }
+        uint8_t mode = opcode_mode(opcode);
+        mode_count[mode] += p->opcode_count[opcode];
+        mode_cycles[mode] += p->opcode_cycles[opcode];
+        mode_crossings[mode] += p->page_crossings[opcode];
+        mode_taken[mode] += p->branches_taken[opcode];
+        fprintf(out, "opcode\t%02X\t%s\t%lu\t%lu\t%lu\t%lu\n", opcode, mode_names[mode], p->opcode_count[opcode],
+                p->opcode_cycles[opcode], p->page_crossings[opcode], p->branches_taken[opcode]);
+    }
+    for (uint8_t mode = 0; mode <= MODE_INDIRECT; mode++) {
+        if (mode_count[mode] == 0) { continue; }
+        fprintf(out, "mode\t%s\t%s\t%lu\t%lu\t%lu\t%lu\n", mode_names[mode], mode_names[mode], mode_count[mode],
+                mode_cycles[mode], mode_crossings[mode], mode_taken[mode]);
+    }
+}
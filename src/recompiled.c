@@ -0,0 +1,50 @@
+#include "recompiled.h"
+#include "cpu_fast.h"
+#include "interrupt.h"
+#include "mapper.h"
+#include "logger.h"
+#include "profiler.h"
+#include "nes.h"
+#include "ppu.h"
+#include "rom_loader.h"
+
+// Runtime of the code generated by the recompiler. Linked into emu_aot together with
+// the generated unit, see the Makefile.
+
+bool is_recompiled_from(nes_rom *rom) {
+    return rom->mapper == MAPPER_NROM && prg_rom_hash(rom) == recompiled_prg_hash;
+}
+
+uint32_t step_recompiled(nes_state *state, uint32_t budget) {
+    uint16_t pc = state->cpu->registers->PC;
+    if (pc >= 0x8000 && recompiled_blocks[pc - 0x8000] != NULL) {
+        return recompiled_blocks[pc - 0x8000](state, budget);
+    }
+    return step_instruction(state);
+}
+
+bool begin_recompiled_instruction(nes_state *state, uint16_t pc, uint8_t opcode) {
+    ppu_run(state, 3);
+    state->cpu->current_opcode_PC = pc;
+    state->cpu->current_opcode = opcode;
+    logger_log(state);
+    profile_boundary(state);
+    return state->cpu->polled_interrupt != 0;
+}
+
+// The fast core takes the interrupt, and runs the instruction at the handler
+uint16_t recompiled_interrupt(nes_state *state) {
+    uint16_t cycles = cpu_fast_step(state);
+    state->master_clock += cycles;
+    ppu_run(state, 3 * (cycles - 1));
+    poll_interrupt_lines(state);
+    return cycles;
+}
+
+uint8_t end_recompiled_instruction(nes_state *state, uint8_t cycles) {
+    state->cpu->cpu_cycle += cycles;
+    state->master_clock += cycles;
+    ppu_run(state, 3 * (cycles - 1));
+    poll_interrupt_lines(state);
+    return cycles;
+}
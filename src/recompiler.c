@@ -0,0 +1,411 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "decode_cache.h"
+#include "mapper.h"
+#include "memory.h"
+#include "microcode.h"
+#include "nes.h"
+#include "rom_loader.h"
+
+// Ahead of time recompiler for mapper 0 roms.
+// All PRG-ROM is mapped from the start, so the code can be traced from the reset, NMI
+// and IRQ vectors, following branches, jumps and subroutine calls.
+// Every traced instruction that starts a run of code (a vector, a jump or branch target,
+// the instruction after a branch, call or io access) gets a C function, which runs
+// the straight-line instructions that only touch RAM and ROM, with the operands
+// and ROM reads as constants. The function stops before the next one starts.
+// Code reached through JMP ($nnnn), RTS or RTI to a place that was not traced,
+// and the instructions touching the PPU/APU registers, run on the fast core.
+// The generated unit is linked with recompiled.c into emu_aot, see the Makefile.
+// Usage: recompiler rom.nes out.c [entry], entry is another address (hex) to trace from
+
+enum EMIT_KIND { EMIT_NONE, EMIT_IMPLIED, EMIT_IMMEDIATE, EMIT_READ, EMIT_WRITE, EMIT_MODIFY, EMIT_JUMP, EMIT_JSR, EMIT_RTS, EMIT_BRANCH };
+
+// How to emit every opcode. Opcodes without an emitter run on the fast core.
+// operation is a statement for implied instructions, a format taking the value read
+// for immediate and read instructions, the value written, or the enum RMW_OP.
+typedef struct EMITTER {
+    uint8_t kind; // enum EMIT_KIND
+    const char *operation;
+} emitter;
+
+#define IMPLIED(s) { EMIT_IMPLIED, s }
+#define IMMEDIATE(f) { EMIT_IMMEDIATE, f }
+#define READ(f) { EMIT_READ, f }
+#define WRITE(v) { EMIT_WRITE, v }
+#define MODIFY(op) { EMIT_MODIFY, op }
+#define BRANCH { EMIT_BRANCH, NULL }
+
+#define ORA "fast_ora(state, %s);"
+#define AND "fast_and(state, %s);"
+#define EOR "fast_eor(state, %s);"
+#define ADC "fast_adc(state, %s);"
+#define SBC "fast_sbc(state, %s);"
+#define CMP "fast_compare(state, regs->ACC, %s);"
+#define CPX "fast_compare(state, regs->X, %s);"
+#define CPY "fast_compare(state, regs->Y, %s);"
+#define BIT "fast_bit(state, %s);"
+#define LDA "fast_load_acc(state, %s);"
+#define LDX "fast_load_x(state, %s);"
+#define LDY "fast_load_y(state, %s);"
+#define LAX "fast_lax(state, %s);"
+#define NOP_READ "(void) %s;"
+
+static const emitter emitters[256] = {
+    [0x09] = IMMEDIATE(ORA), [0x05] = READ(ORA), [0x15] = READ(ORA),
+    [0x0D] = READ(ORA), [0x1D] = READ(ORA), [0x19] = READ(ORA),
+    [0x29] = IMMEDIATE(AND), [0x25] = READ(AND), [0x35] = READ(AND),
+    [0x2D] = READ(AND), [0x3D] = READ(AND), [0x39] = READ(AND),
+    [0x49] = IMMEDIATE(EOR), [0x45] = READ(EOR), [0x55] = READ(EOR),
+    [0x4D] = READ(EOR), [0x5D] = READ(EOR), [0x59] = READ(EOR),
+    [0x69] = IMMEDIATE(ADC), [0x65] = READ(ADC), [0x75] = READ(ADC),
+    [0x6D] = READ(ADC), [0x7D] = READ(ADC), [0x79] = READ(ADC),
+    [0xE9] = IMMEDIATE(SBC), [0xEB] = IMMEDIATE(SBC), [0xE5] = READ(SBC),
+    [0xF5] = READ(SBC), [0xED] = READ(SBC),
+    [0xFD] = READ(SBC), [0xF9] = READ(SBC),
+    [0xC9] = IMMEDIATE(CMP), [0xC5] = READ(CMP), [0xD5] = READ(CMP),
+    [0xCD] = READ(CMP), [0xDD] = READ(CMP), [0xD9] = READ(CMP),
+    [0xE0] = IMMEDIATE(CPX), [0xE4] = READ(CPX), [0xEC] = READ(CPX),
+    [0xC0] = IMMEDIATE(CPY), [0xC4] = READ(CPY), [0xCC] = READ(CPY),
+    [0x24] = READ(BIT), [0x2C] = READ(BIT),
+    [0xA9] = IMMEDIATE(LDA), [0xA5] = READ(LDA), [0xB5] = READ(LDA),
+    [0xAD] = READ(LDA), [0xBD] = READ(LDA), [0xB9] = READ(LDA),
+    [0xA2] = IMMEDIATE(LDX), [0xA6] = READ(LDX), [0xB6] = READ(LDX),
+    [0xAE] = READ(LDX), [0xBE] = READ(LDX),
+    [0xA0] = IMMEDIATE(LDY), [0xA4] = READ(LDY), [0xB4] = READ(LDY),
+    [0xAC] = READ(LDY), [0xBC] = READ(LDY),
+    [0xA7] = READ(LAX), [0xB7] = READ(LAX),
+    [0xAF] = READ(LAX), [0xBF] = READ(LAX),
+    [0x80] = IMMEDIATE(NOP_READ), [0x82] = IMMEDIATE(NOP_READ), [0x89] = IMMEDIATE(NOP_READ),
+    [0xC2] = IMMEDIATE(NOP_READ), [0xE2] = IMMEDIATE(NOP_READ),
+    [0x04] = READ(NOP_READ), [0x44] = READ(NOP_READ), [0x64] = READ(NOP_READ),
+    [0x14] = READ(NOP_READ), [0x34] = READ(NOP_READ), [0x54] = READ(NOP_READ),
+    [0x74] = READ(NOP_READ), [0xD4] = READ(NOP_READ), [0xF4] = READ(NOP_READ),
+    [0x0C] = READ(NOP_READ),
+    [0x1C] = READ(NOP_READ), [0x3C] = READ(NOP_READ), [0x5C] = READ(NOP_READ),
+    [0x7C] = READ(NOP_READ), [0xDC] = READ(NOP_READ), [0xFC] = READ(NOP_READ),
+
+    [0x85] = WRITE("regs->ACC"), [0x95] = WRITE("regs->ACC"), [0x8D] = WRITE("regs->ACC"),
+    [0x9D] = WRITE("regs->ACC"), [0x99] = WRITE("regs->ACC"),
+    [0x86] = WRITE("regs->X"), [0x96] = WRITE("regs->X"), [0x8E] = WRITE("regs->X"),
+    [0x84] = WRITE("regs->Y"), [0x94] = WRITE("regs->Y"), [0x8C] = WRITE("regs->Y"),
+    [0x87] = WRITE("regs->ACC & regs->X"), [0x97] = WRITE("regs->ACC & regs->X"),
+    [0x8F] = WRITE("regs->ACC & regs->X"),
+
+    [0x06] = MODIFY("RMW_ASL"), [0x16] = MODIFY("RMW_ASL"),
+    [0x0E] = MODIFY("RMW_ASL"), [0x1E] = MODIFY("RMW_ASL"),
+    [0x26] = MODIFY("RMW_ROL"), [0x36] = MODIFY("RMW_ROL"),
+    [0x2E] = MODIFY("RMW_ROL"), [0x3E] = MODIFY("RMW_ROL"),
+    [0x46] = MODIFY("RMW_LSR"), [0x56] = MODIFY("RMW_LSR"),
+    [0x4E] = MODIFY("RMW_LSR"), [0x5E] = MODIFY("RMW_LSR"),
+    [0x66] = MODIFY("RMW_ROR"), [0x76] = MODIFY("RMW_ROR"),
+    [0x6E] = MODIFY("RMW_ROR"), [0x7E] = MODIFY("RMW_ROR"),
+    [0xE6] = MODIFY("RMW_INC"), [0xF6] = MODIFY("RMW_INC"),
+    [0xEE] = MODIFY("RMW_INC"), [0xFE] = MODIFY("RMW_INC"),
+    [0xC6] = MODIFY("RMW_DEC"), [0xD6] = MODIFY("RMW_DEC"),
+    [0xCE] = MODIFY("RMW_DEC"), [0xDE] = MODIFY("RMW_DEC"),
+    [0x07] = MODIFY("RMW_SLO"), [0x17] = MODIFY("RMW_SLO"), [0x0F] = MODIFY("RMW_SLO"),
+    [0x1F] = MODIFY("RMW_SLO"), [0x1B] = MODIFY("RMW_SLO"),
+    [0x27] = MODIFY("RMW_RLA"), [0x37] = MODIFY("RMW_RLA"), [0x2F] = MODIFY("RMW_RLA"),
+    [0x3F] = MODIFY("RMW_RLA"), [0x3B] = MODIFY("RMW_RLA"),
+    [0x47] = MODIFY("RMW_SRE"), [0x57] = MODIFY("RMW_SRE"), [0x4F] = MODIFY("RMW_SRE"),
+    [0x5F] = MODIFY("RMW_SRE"), [0x5B] = MODIFY("RMW_SRE"),
+    [0x67] = MODIFY("RMW_RRA"), [0x77] = MODIFY("RMW_RRA"), [0x6F] = MODIFY("RMW_RRA"),
+    [0x7F] = MODIFY("RMW_RRA"), [0x7B] = MODIFY("RMW_RRA"),
+    [0xC7] = MODIFY("RMW_DCP"), [0xD7] = MODIFY("RMW_DCP"), [0xCF] = MODIFY("RMW_DCP"),
+    [0xDF] = MODIFY("RMW_DCP"), [0xDB] = MODIFY("RMW_DCP"),
+    [0xE7] = MODIFY("RMW_ISB"), [0xF7] = MODIFY("RMW_ISB"), [0xEF] = MODIFY("RMW_ISB"),
+    [0xFF] = MODIFY("RMW_ISB"), [0xFB] = MODIFY("RMW_ISB"),
+
+    [0x0A] = IMPLIED("regs->ACC = fast_asl(state, regs->ACC);"),
+    [0x4A] = IMPLIED("regs->ACC = fast_lsr(state, regs->ACC);"),
+    [0x2A] = IMPLIED("regs->ACC = fast_rol(state, regs->ACC);"),
+    [0x6A] = IMPLIED("regs->ACC = fast_ror(state, regs->ACC);"),
+    [0xE8] = IMPLIED("fast_load_x(state, regs->X + 1);"),
+    [0xC8] = IMPLIED("fast_load_y(state, regs->Y + 1);"),
+    [0xCA] = IMPLIED("fast_load_x(state, regs->X - 1);"),
+    [0x88] = IMPLIED("fast_load_y(state, regs->Y - 1);"),
+    [0xAA] = IMPLIED("fast_load_x(state, regs->ACC);"),
+    [0xA8] = IMPLIED("fast_load_y(state, regs->ACC);"),
+    [0x8A] = IMPLIED("fast_load_acc(state, regs->X);"),
+    [0x98] = IMPLIED("fast_load_acc(state, regs->Y);"),
+    [0xBA] = IMPLIED("fast_load_x(state, regs->SP);"),
+    [0x9A] = IMPLIED("regs->SP = regs->X;"),
+    [0x48] = IMPLIED("fast_push_byte(state, regs->ACC);"),
+    [0x68] = IMPLIED("fast_load_acc(state, fast_pull_byte(state));"),
+    [0x08] = IMPLIED("fast_push_byte(state, 48 | regs->SR);"),
+    [0x28] = IMPLIED("regs->SR = (fast_pull_byte(state) & 0xcf) | (regs->SR & 0x30);"),
+    [0x18] = IMPLIED("clear_carry_flag(state);"),
+    [0x38] = IMPLIED("set_carry_flag(state);"),
+    [0x78] = IMPLIED("set_interrupt_flag(state);"),
+    [0xB8] = IMPLIED("clear_overflow_flag(state);"),
+    [0xD8] = IMPLIED("clear_decimal_flag(state);"),
+    [0xF8] = IMPLIED("set_decimal_flag(state);"),
+    [0xEA] = IMPLIED(""), [0x1A] = IMPLIED(""), [0x3A] = IMPLIED(""), [0x5A] = IMPLIED(""),
+    [0x7A] = IMPLIED(""), [0xDA] = IMPLIED(""), [0xFA] = IMPLIED(""),
+
+    [0x4C] = { EMIT_JUMP, NULL },
+    [0x20] = { EMIT_JSR, NULL },
+    [0x60] = { EMIT_RTS, NULL },
+    [0x10] = BRANCH, [0x30] = BRANCH, [0x50] = BRANCH, [0x70] = BRANCH,
+    [0x90] = BRANCH, [0xB0] = BRANCH, [0xD0] = BRANCH, [0xF0] = BRANCH,
+};
+
+
+// What the trace found, by PC - 0x8000
+static decoded_instruction traced[0x8000];
+static bool leader[0x8000];
+
+
+static bool is_prg(uint32_t pc) {
+    return pc >= 0x8000 && pc <= 0xFFFF;
+}
+
+// Does the instruction leave the straight line of code?
+static bool ends_run(const decoded_instruction *d) {
+    uint8_t kind = emitters[d->opcode].kind;
+    return kind == EMIT_JUMP || kind == EMIT_JSR || kind == EMIT_RTS || kind == EMIT_BRANCH;
+}
+
+// No fall through to the next instruction: JMP, JMP ($nnnn), RTS, RTI, BRK, and the opcodes that lock up
+static bool stops_trace(const decoded_instruction *d) {
+    return d->program == NULL || d->opcode == 0x4C || d->opcode == 0x6C
+        || d->opcode == 0x60 || d->opcode == 0x40 || d->opcode == 0x00;
+}
+
+// Is every address the instruction can touch RAM (or ROM, for reads)?
+// Zero page addresses are always RAM.
+static bool is_plain_memory(const emitter *e, const decoded_instruction *d) {
+    if (d->mode != MODE_ABSOLUTE && d->mode != MODE_ABSOLUTE_X && d->mode != MODE_ABSOLUTE_Y) {
+        return true;
+    }
+    uint16_t addr = d->operand;
+    uint32_t last = addr;
+    if (d->mode != MODE_ABSOLUTE) { last += 0xFF; }
+    if (last < 0x2000) { return true; }
+    return e->kind == EMIT_READ && addr >= 0x8000;
+}
+
+static bool can_emit(const decoded_instruction *d) {
+    const emitter *e = &emitters[d->opcode];
+    return e->kind != EMIT_NONE && is_plain_memory(e, d);
+}
+
+// Follow the code from pc, and everything it can jump, branch or call to
+static void trace(nes_state *state, uint16_t start, uint32_t *count) {
+    static uint16_t worklist[0x8000];
+    uint32_t pending = 0;
+    if (!is_prg(start)) { return; }
+    leader[start - 0x8000] = true;
+    worklist[pending++] = start;
+    while (pending > 0) {
+        uint32_t pc = worklist[--pending];
+        while (is_prg(pc) && !traced[pc - 0x8000].valid) {
+            const decoded_instruction *d = decode_instruction(state, pc);
+            if (pc + d->size - 1 > 0xFFFF) { break; }
+            traced[pc - 0x8000] = *d;
+            (*count)++;
+            uint32_t next = pc + d->size;
+            uint32_t target = 0x10000;
+            if (d->mode == MODE_RELATIVE) { target = (uint16_t) (next + (int8_t) d->operand); }
+            if (d->opcode == 0x4C || d->opcode == 0x20) { target = d->operand; }
+            if (is_prg(target) && pending < 0x8000) {
+                leader[target - 0x8000] = true;
+                worklist[pending++] = target;
+            }
+            if (stops_trace(d)) { break; }
+            // The run of the function ends here, the next instruction starts another
+            if (is_prg(next) && (ends_run(d) || !can_emit(d))) { leader[next - 0x8000] = true; }
+            pc = next;
+        }
+    }
+}
+
+
+// The value a read instruction reads, as a C expression.
+// ROM can't change, so it is read now. Indexed modes put the address in addr first.
+static void format_value(nes_state *state, char *out, size_t size, const decoded_instruction *d) {
+    uint16_t op = d->operand;
+    const char *index = d->mode == MODE_ZEROPAGE_Y || d->mode == MODE_ABSOLUTE_Y ? "regs->Y" : "regs->X";
+    switch (d->mode) {
+    case MODE_IMMEDIATE:
+        snprintf(out, size, "0x%02X", op);
+        break;
+    case MODE_ZEROPAGE:
+        snprintf(out, size, "state->memory[0x%02X]", op);
+        break;
+    case MODE_ZEROPAGE_X:
+    case MODE_ZEROPAGE_Y:
+        snprintf(out, size, "state->memory[(uint8_t) (0x%02X + %s)]", op, index);
+        break;
+    case MODE_ABSOLUTE:
+        if (op < 0x2000) { snprintf(out, size, "state->memory[0x%03X]", op & 0x7FF); }
+        else { snprintf(out, size, "0x%02X", peek_mem(state, op)); }
+        break;
+    default:
+        if (op + 0xFF < 0x2000) { snprintf(out, size, "state->memory[addr & 0x7FF]"); }
+        else { snprintf(out, size, "read_mem(state, addr)"); }
+        break;
+    }
+}
+
+// The address an instruction writes or modifies, as a C expression
+static void format_address(char *out, size_t size, const decoded_instruction *d) {
+    uint16_t op = d->operand;
+    const char *index = d->mode == MODE_ZEROPAGE_Y || d->mode == MODE_ABSOLUTE_Y ? "regs->Y" : "regs->X";
+    switch (d->mode) {
+    case MODE_ZEROPAGE:
+        snprintf(out, size, "0x%02X", op);
+        break;
+    case MODE_ZEROPAGE_X:
+    case MODE_ZEROPAGE_Y:
+        snprintf(out, size, "(uint8_t) (0x%02X + %s)", op, index);
+        break;
+    case MODE_ABSOLUTE:
+        snprintf(out, size, "0x%04X", op);
+        break;
+    default:
+        snprintf(out, size, "(uint16_t) (0x%04X + %s)", op, index);
+        break;
+    }
+}
+
+static void emit_instruction(nes_state *state, FILE *out, uint16_t pc, const decoded_instruction *d) {
+    const emitter *e = &emitters[d->opcode];
+    uint16_t next = pc + d->size;
+    char text[96];
+    fprintf(out, "    // $%04X: %02X", pc, d->opcode);
+    if (d->size > 1) { fprintf(out, " %02X", d->operand & 0xFF); }
+    if (d->size > 2) { fprintf(out, " %02X", d->operand >> 8); }
+    fprintf(out, "\n");
+    fprintf(out, "    if (cycles >= budget) { return cycles; }\n");
+    fprintf(out, "    if (begin_recompiled_instruction(state, 0x%04X, 0x%02X)) { return cycles + recompiled_interrupt(state); }\n",
+            pc, d->opcode);
+    fprintf(out, "    c = %u;\n", d->cycles);
+    switch (e->kind) {
+    case EMIT_IMPLIED:
+        fprintf(out, "    regs->PC = 0x%04X;\n", next);
+        if (e->operation[0] != '\0') { fprintf(out, "    %s\n", e->operation); }
+        break;
+    case EMIT_IMMEDIATE:
+    case EMIT_READ:
+        if (d->mode == MODE_ABSOLUTE_X || d->mode == MODE_ABSOLUTE_Y) {
+            fprintf(out, "    addr = 0x%04X + %s;\n", d->operand, d->mode == MODE_ABSOLUTE_X ? "regs->X" : "regs->Y");
+            fprintf(out, "    if ((addr & 0xFF00) != 0x%04X) { c++; }\n", d->operand & 0xFF00);
+        }
+        fprintf(out, "    regs->PC = 0x%04X;\n", next);
+        format_value(state, text, sizeof(text), d);
+        fprintf(out, "    ");
+        fprintf(out, e->operation, text);
+        fprintf(out, "\n");
+        break;
+    case EMIT_WRITE:
+        format_address(text, sizeof(text), d);
+        fprintf(out, "    regs->PC = 0x%04X;\n", next);
+        fprintf(out, "    state->memory[(%s) & 0x7FF] = %s;\n", text, e->operation);
+        break;
+    case EMIT_MODIFY:
+        format_address(text, sizeof(text), d);
+        fprintf(out, "    regs->PC = 0x%04X;\n", next);
+        fprintf(out, "    fast_read_modify_write(state, %s, %s);\n", text, e->operation);
+        break;
+    case EMIT_JUMP:
+        fprintf(out, "    regs->PC = 0x%04X;\n", d->operand);
+        break;
+    case EMIT_JSR:
+        fprintf(out, "    fast_push_byte(state, 0x%02X);\n", (uint16_t) (next - 1) >> 8);
+        fprintf(out, "    fast_push_byte(state, 0x%02X);\n", (uint16_t) (next - 1) & 0xFF);
+        fprintf(out, "    regs->PC = 0x%04X;\n", d->operand);
+        break;
+    case EMIT_RTS:
+        fprintf(out, "    addr = fast_pull_byte(state);\n");
+        fprintf(out, "    regs->PC = (addr | ((uint16_t) fast_pull_byte(state) << 8)) + 1;\n");
+        break;
+    case EMIT_BRANCH: {
+        // Same condition as the branch programs in microcode.c
+        uint16_t target = next + (int8_t) d->operand;
+        fprintf(out, "    if ((regs->SR & 0x%02X) != 0x%02X) { regs->PC = 0x%04X; }\n",
+                d->program->branch_mask, d->program->branch_value, next);
+        fprintf(out, "    else { regs->PC = 0x%04X; c += %u; }\n", target, (next & 0xFF00) != (target & 0xFF00) ? 2 : 1);
+        break;
+    }
+    }
+    fprintf(out, "    cycles += end_recompiled_instruction(state, c);\n");
+}
+
+// The function for the run of code starting at pc, up to the next leader,
+// a jump or branch, or an instruction that can't be emitted
+static void emit_function(nes_state *state, FILE *out, uint16_t start) {
+    fprintf(out, "static uint32_t block_%04X(nes_state *state, uint32_t budget) {\n", start);
+    fprintf(out, "    registers *regs = state->cpu->registers;\n");
+    fprintf(out, "    uint32_t cycles = 0;\n");
+    fprintf(out, "    uint16_t addr = 0;\n");
+    fprintf(out, "    uint8_t c;\n");
+    uint32_t pc = start;
+    do {
+        const decoded_instruction *d = &traced[pc - 0x8000];
+        emit_instruction(state, out, pc, d);
+        if (ends_run(d)) { break; }
+        pc += d->size;
+    } while (is_prg(pc) && traced[pc - 0x8000].valid && !leader[pc - 0x8000] && can_emit(&traced[pc - 0x8000]));
+    fprintf(out, "    (void) addr;\n");
+    fprintf(out, "    return cycles;\n");
+    fprintf(out, "}\n\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3 && argc != 4) {
+        fprintf(stderr, "Usage: %s rom.nes out.c [entry]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    nes_rom *rom = malloc(sizeof(nes_rom));
+    if (load_rom2(argv[1], rom) != 0) {
+        return EXIT_FAILURE;
+    }
+    // The code of a board switching banks isn't known until it runs
+    if (rom->mapper != MAPPER_NROM) {
+        fprintf(stderr, "Only mapper 0 roms can be recompiled, %s uses mapper %u\n", argv[1], rom->mapper);
+        return EXIT_FAILURE;
+    }
+    nes_state *state = init_state();
+    attach_rom(state, rom);
+
+    uint32_t count = 0;
+    const uint16_t vectors[] = { 0xFFFC, 0xFFFA, 0xFFFE };
+    for (uint8_t i = 0; i < 3; i++) {
+        uint16_t addr = peek_mem(state, vectors[i]) | ((uint16_t) peek_mem(state, vectors[i] + 1) << 8);
+        trace(state, addr, &count);
+    }
+    // e.g. the entry point of nestest's automated mode, C000
+    if (argc > 3) { trace(state, (uint16_t) strtol(argv[3], NULL, 16), &count); }
+
+    FILE *out = fopen(argv[2], "w");
+    if (out == NULL) {
+        perror("fopen() failed");
+        return EXIT_FAILURE;
+    }
+    fprintf(out, "// Generated by recompiler from %s, do not edit\n", argv[1]);
+    fprintf(out, "#include \"cpu.h\"\n#include \"cpu_fast.h\"\n#include \"memory.h\"\n#include \"recompiled.h\"\n\n");
+    uint32_t functions = 0;
+    for (uint32_t pc = 0x8000; pc <= 0xFFFF; pc++) {
+        if (leader[pc - 0x8000] && traced[pc - 0x8000].valid && can_emit(&traced[pc - 0x8000])) {
+            emit_function(state, out, pc);
+            functions++;
+        }
+    }
+    fprintf(out, "const uint32_t recompiled_prg_hash = 0x%08X;\n\n", prg_rom_hash(rom));
+    fprintf(out, "const recompiled_block recompiled_blocks[0x8000] = {\n");
+    for (uint32_t pc = 0x8000; pc <= 0xFFFF; pc++) {
+        if (leader[pc - 0x8000] && traced[pc - 0x8000].valid && can_emit(&traced[pc - 0x8000])) {
+            fprintf(out, "    [0x%04X] = block_%04X,\n", pc - 0x8000, pc);
+        }
+    }
+    fprintf(out, "};\n");
+    fclose(out);
+    fprintf(stderr, "Traced %u instructions, wrote %u functions to %s\n", count, functions, argv[2]);
+
+    destroy_state(state);
+    return 0;
+}
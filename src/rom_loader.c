@@ -1,6 +1,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <string.h>
 #include <stdint.h>
 #include "definitions.h"
@@ -42,53 +45,63 @@ bool get_vs_system_cartridge(uint8_t *rombuf) {
   return (rombuf[7] & 1);
 }
 
+uint8_t get_prg_ram_size(uint8_t *rombuf) {
+  return rombuf[8];
+}
 
-int load_rom2(char *filename, uint8_t **rombuf, nes_rom *rom) {
 
-  FILE *infile;
+int load_rom2(char *filename, nes_rom *rom) {
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0) { perror("open() failed"); return EXIT_FAILURE; }
   struct stat romfilestat;
-  int fstatus = stat(filename, &romfilestat);
-  if (fstatus != 0) { perror("stat call failed.\n"); return EXIT_FAILURE; }
+  if (fstat(fd, &romfilestat) != 0) { perror("fstat call failed"); close(fd); return EXIT_FAILURE; }
 
   printf("Filename: %s\nFilesize: %ld\n", filename, romfilestat.st_size);
-  if ((infile = fopen(filename, "r")) == NULL) {
-    perror("fopen() failed");
+  if (romfilestat.st_size < 16) {
+    fprintf(stderr, "%s is too short for an iNES header\n", filename);
+    close(fd);
     return EXIT_FAILURE;
   }
-  *rombuf = malloc(romfilestat.st_size);
-
-  fread(*rombuf, 1, romfilestat.st_size, infile);
-  fclose(infile);
-
-  rom->prg_rom_size = get_prg_rom_size(*rombuf);
-  rom->chr_rom_size = get_chr_rom_size(*rombuf);
-  rom->mirroring = get_mirroring(*rombuf);
-  rom->battery_backed = get_battery(*rombuf);
-  rom->trainer = get_trainer(*rombuf);
-  rom->four_screen_VRAM = get_four_screen_vram(*rombuf);
-  rom->vs_system_cartridge = get_vs_system_cartridge(*rombuf);
-  rom->mapper = get_mapper(*rombuf);
-
-  rom->prg_rom1 = malloc(0x4000);
-  rom->prg_rom2 = malloc(0x4000);
+  // The image is only read, instances of the same rom share its pages
+  uint8_t *rombuf = mmap(NULL, romfilestat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (rombuf == MAP_FAILED) { perror("mmap() failed"); return EXIT_FAILURE; }
+
+  rom->prg_rom_size = get_prg_rom_size(rombuf);
+  rom->chr_rom_size = get_chr_rom_size(rombuf);
+  rom->mirroring = get_mirroring(rombuf);
+  rom->battery_backed = get_battery(rombuf);
+  rom->trainer = get_trainer(rombuf);
+  rom->four_screen_VRAM = get_four_screen_vram(rombuf);
+  rom->vs_system_cartridge = get_vs_system_cartridge(rombuf);
+  rom->mapper = get_mapper(rombuf);
+  rom->prg_ram_size = get_prg_ram_size(rombuf);
+
   uint32_t prg_start = 16;
   if (rom->trainer) { prg_start += 512; }
-  // If only 16kb PRG_ROM, mirror it
-  if (rom->prg_rom_size == 1) {
-    memcpy(rom->prg_rom1, *rombuf+prg_start, 0x4000);
-    memcpy(rom->prg_rom2, *rombuf+prg_start, 0x4000);
+  uint32_t prg_rom_bytes = rom->prg_rom_size * 0x4000;
+  uint32_t chr_rom_bytes = rom->chr_rom_size * 0x2000;
+  uint32_t chr_rom_offset = prg_start + prg_rom_bytes;
+  // The banks the header promises must all be in the file
+  if (memcmp(rombuf, "NES\x1a", 4) != 0 || rom->prg_rom_size == 0 ||
+      (uint64_t) romfilestat.st_size < (uint64_t) chr_rom_offset + chr_rom_bytes) {
+    fprintf(stderr, "%s is not an iNES rom, or shorter than its header says (%u + %u kb)\n",
+            filename, prg_rom_bytes / 1024, chr_rom_bytes / 1024);
+    munmap(rombuf, romfilestat.st_size);
+    return EXIT_FAILURE;
   }
-  if (rom->prg_rom_size == 2) {
-    memcpy(rom->prg_rom1, *rombuf+prg_start, 0x4000);
-    memcpy(rom->prg_rom2, *rombuf+prg_start+0x4000, 0x4000);
+  rom->image = rombuf;
+  rom->image_size = romfilestat.st_size;
+
+  // All the banks, the mapper decides what is mapped where (see mapper.c).
+  // They are the image itself, PRG-ROM and CHR ROM are never written.
+  rom->prg_rom = rombuf + prg_start;
+  rom->chr_rom = rombuf + chr_rom_offset;
+  // Boards without CHR ROM have 8kb of CHR RAM
+  if (chr_rom_bytes == 0) {
+    rom->chr_rom = calloc(0x2000, 1);
   }
 
-  // For now, we ONLY do mapper 0, which does not bankswitch
-  // And has a maximum of 8 kb CHR rom available
-  rom->chr_rom = malloc(0x2000);
-  uint32_t chr_rom_offset = prg_start + (rom->prg_rom_size * 0x4000);
-  memcpy(rom->chr_rom, *rombuf+chr_rom_offset, 0x2000);
-
   return 0;
 }
 
@@ -154,9 +167,28 @@ void print_rom_info(nes_rom *rom) {
 }
 
 
+// FNV-1a over the 32kb mapper 0 maps at $8000-$FFFF (the first and the last 16kb bank),
+// identifies the rom a recompiled unit was made from
+uint32_t prg_rom_hash(nes_rom *rom) {
+  const uint8_t *last_bank = rom->prg_rom + (rom->prg_rom_size - 1) * 0x4000;
+  uint32_t hash = 2166136261u;
+  for (uint32_t i = 0; i < 0x8000; i++) {
+    hash ^= i < 0x4000 ? rom->prg_rom[i] : last_bank[i - 0x4000];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// A rom from load_rom2 points into its image, except for CHR RAM.
+// Roms built in memory (without an image) own both banks.
 void free_rom(nes_rom *rom) {
-  free(rom->prg_rom1);
-  free(rom->prg_rom2);
-  free(rom->chr_rom);
+  if (rom->image != NULL) {
+    munmap(rom->image, rom->image_size);
+    if (rom->chr_rom_size == 0) { free(rom->chr_rom); }
+  }
+  else {
+    free(rom->prg_rom);
+    free(rom->chr_rom);
+  }
   free(rom);
 }
@@ -73,9 +73,8 @@ int main (int argc, char **argv)
     return 0;
   }
 
-  unsigned char *rombuf;
   nes_rom *my_rom = malloc(sizeof(nes_rom));
-  int romret = load_rom2(argv[1], &rombuf, my_rom);
+  int romret = load_rom2(argv[1], my_rom);
   if (romret != 0) { printf("Something went wrong when loading rom..\n"); return 1; }
   printf("rom loaded: %d\n", romret);
   print_rom_info(my_rom);
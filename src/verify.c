@@ -0,0 +1,273 @@
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "cpu.h"
+#include "idle_loop.h"
+#include "mapper.h"
+#include "nes.h"
+#include "rom_loader.h"
+
+// Lockstep verifier. Runs a rom on the cycle core (the reference) and on another core
+// side by side, and compares the registers, RAM and cpu_cycle every time both are
+// at the same instruction boundary. Stops a rom at the first difference, and prints
+// what differs and the last instructions the reference ran.
+// Arguments are roms, or directories of .nes files.
+// With -r it instead checks on every core that INC $8000 resets MMC1, which needs the dummy
+// write of read-modify-write instructions.
+// The emulator prints to stdout, so the report is written to stderr.
+// Usage: verify [-f|-y] [-i] [-c cycles] [-s pc] [-n instructions] rom|dir...
+//        verify -r
+
+#define MAX_HISTORY 64
+
+static const char *core_names[] = { "cycle", "fast", "sync" };
+
+// An instruction both cores ran, with the registers after it
+typedef struct BOUNDARY {
+  uint64_t cycle;
+  uint16_t pc;
+  uint8_t opcode, acc, x, y, sp, sr;
+} boundary;
+
+static uint8_t core = FAST_CORE;
+static bool skip_idle_loops = false;
+static uint32_t cycles_to_run = 100000;
+static bool overwrite_pc = false;
+static uint16_t new_pc = 0;
+static uint32_t history_length = 16;
+
+static nes_state *start(char *filename, uint8_t state_core) {
+  nes_rom *rom = malloc(sizeof(nes_rom));
+  if (load_rom2(filename, rom) != 0) {
+    free(rom);
+    return NULL;
+  }
+  nes_state *state = init_state();
+  state->core = state_core;
+  attach_rom(state, rom);
+  reset(state);
+  if (overwrite_pc) {
+    set_pc(state, new_pc);
+  }
+  return state;
+}
+
+static void print_boundary(const boundary *b) {
+  fprintf(stderr, "  %04X  %02X  A:%02X X:%02X Y:%02X P:%02X SP:%02X CYC:%lu\n",
+          b->pc, b->opcode, b->acc, b->x, b->y, b->sr, b->sp, b->cycle);
+}
+
+// Does anything differ between the two states? Prints what does if print is set.
+static bool compare(nes_state *ref, nes_state *test, bool print) {
+  registers *a = ref->cpu->registers;
+  registers *b = test->cpu->registers;
+  build_status_reg(ref);
+  build_status_reg(test);
+  bool differs = false;
+  if (ref->cpu->cpu_cycle != test->cpu->cpu_cycle) {
+    if (print) { fprintf(stderr, "  cpu_cycle: %lu %lu\n", ref->cpu->cpu_cycle, test->cpu->cpu_cycle); }
+    differs = true;
+  }
+  if (a->PC != b->PC) { if (print) fprintf(stderr, "  PC: %04X %04X\n", a->PC, b->PC); differs = true; }
+  if (a->ACC != b->ACC) { if (print) fprintf(stderr, "  A: %02X %02X\n", a->ACC, b->ACC); differs = true; }
+  if (a->X != b->X) { if (print) fprintf(stderr, "  X: %02X %02X\n", a->X, b->X); differs = true; }
+  if (a->Y != b->Y) { if (print) fprintf(stderr, "  Y: %02X %02X\n", a->Y, b->Y); differs = true; }
+  if (a->SP != b->SP) { if (print) fprintf(stderr, "  SP: %02X %02X\n", a->SP, b->SP); differs = true; }
+  if (a->SR != b->SR) { if (print) fprintf(stderr, "  P: %02X %02X\n", a->SR, b->SR); differs = true; }
+  if (memcmp(ref->memory, test->memory, 0x800) != 0) {
+    uint32_t shown = 0;
+    for (uint16_t i = 0; i < 0x800; i++) {
+      if (ref->memory[i] == test->memory[i]) { continue; }
+      if (shown++ < 16 && print) { fprintf(stderr, "  $%04X: %02X %02X\n", i, ref->memory[i], test->memory[i]); }
+    }
+    if (print && shown > 16) { fprintf(stderr, "  ... and %u more RAM bytes\n", shown - 16); }
+    differs = true;
+  }
+  return differs;
+}
+
+// Run a rom on both cores. Returns true if they agree for the whole run.
+static bool verify(char *filename) {
+  nes_state *ref = start(filename, CYCLE_CORE);
+  if (ref == NULL) { return false; }
+  nes_state *test = start(filename, core);
+  if (test == NULL) {
+    destroy_state(ref);
+    return false;
+  }
+  if (skip_idle_loops) {
+    enable_idle_loop_skipping(test);
+  }
+
+  boundary history[MAX_HISTORY];
+  uint64_t instructions = 0;
+  uint64_t start_cycle = ref->cpu->cpu_cycle;
+  bool ok = true;
+  const char *reason = NULL;
+  while (ref->cpu->cpu_cycle - start_cycle < cycles_to_run) {
+    // One step of the core under test, then the reference up to the same cycle
+    step_core(test, 1);
+    while (ref->cpu->cpu_cycle < test->cpu->cpu_cycle && !ref->fatal_error) {
+      step(ref);
+    }
+    if (ref->fatal_error || test->fatal_error) {
+      if (ref->fatal_error != test->fatal_error) { reason = "only one core stopped with a fatal error"; }
+      break;
+    }
+    if (!is_instruction_done(ref) || ref->cpu->cpu_cycle != test->cpu->cpu_cycle) {
+      reason = "instruction boundaries differ";
+    }
+    else if (compare(ref, test, false)) {
+      reason = "state differs (reference, test)";
+    }
+    if (reason != NULL) { break; }
+    registers *regs = ref->cpu->registers;
+    boundary *b = &history[instructions++ % MAX_HISTORY];
+    b->cycle = ref->cpu->cpu_cycle;
+    b->pc = ref->cpu->current_opcode_PC;
+    b->opcode = ref->cpu->current_opcode;
+    b->acc = regs->ACC;
+    b->x = regs->X;
+    b->y = regs->Y;
+    b->sp = regs->SP;
+    b->sr = regs->SR;
+  }
+
+  if (reason != NULL) {
+    ok = false;
+    fprintf(stderr, "%s: FAIL after %lu instructions, at the instruction at $%04X: %s\n",
+            filename, instructions, ref->cpu->current_opcode_PC, reason);
+    compare(ref, test, true);
+    uint64_t shown = instructions < history_length ? instructions : history_length;
+    fprintf(stderr, " last %lu instructions of the reference, registers after them:\n", shown);
+    for (uint64_t i = instructions - shown; i < instructions; i++) {
+      print_boundary(&history[i % MAX_HISTORY]);
+    }
+  }
+  else {
+    fprintf(stderr, "%s: OK, %lu instructions, %lu cycles\n", filename, instructions, ref->cpu->cpu_cycle - start_cycle);
+  }
+
+  destroy_state(ref);
+  destroy_state(test);
+  return ok;
+}
+
+// An MMC1 rom that clears the control register, shifts in two bits and then runs INC $8000
+// on the $FF there. The dummy write of $FF resets the shift register and sets the PRG mode
+// bits of control, the write of $00 right after it is ignored.
+static nes_rom *mmc1_rmw_rom(void) {
+  static const uint8_t code[] = {
+    0xA9, 0x00, // LDA #$00
+    0x8D, 0x00, 0x80, 0x8D, 0x00, 0x80, 0x8D, 0x00, 0x80, 0x8D, 0x00, 0x80, 0x8D, 0x00, 0x80, // STA $8000 x5
+    0xA9, 0x01, // LDA #$01
+    0x8D, 0x00, 0x80, 0x8D, 0x00, 0x80, // STA $8000 x2
+    0xEE, 0x00, 0x80, // INC $8000
+    0x4C, 0x1C, 0xC0 // JMP $C01C
+  };
+  // 32kb, the code at $C000 is there in the fixed and in the 32kb mode
+  uint8_t *prg = calloc(0x8000, 1);
+  prg[0x0000] = 0xFF;
+  memcpy(&prg[0x4000], code, sizeof(code));
+  for (uint16_t vector = 0xFFFA; vector != 0; vector += 2) {
+    prg[vector - 0x8000] = 0x00;
+    prg[vector - 0x8000 + 1] = 0xC0;
+  }
+  nes_rom *rom = calloc(1, sizeof(nes_rom));
+  rom->prg_rom_size = 2;
+  rom->mapper = MAPPER_MMC1;
+  rom->prg_rom = prg;
+  rom->chr_rom = calloc(0x2000, 1);
+  return rom;
+}
+
+static bool verify_mmc1_rmw(uint8_t state_core) {
+  nes_state *state = init_state();
+  state->core = state_core;
+  attach_rom(state, mmc1_rmw_rom());
+  reset(state);
+  uint64_t end_cycle = state->cpu->cpu_cycle + 200;
+  while (state->cpu->cpu_cycle < end_cycle && !state->fatal_error) {
+    step_core(state, end_cycle - state->cpu->cpu_cycle);
+  }
+  mapper *m = state->mapper;
+  bool ok = !state->fatal_error && m->shift_count == 0 && m->registers[0] == 0x0C;
+  fprintf(stderr, "INC $8000 on MMC1, %s core: %s (control %02X, %u bits shifted in)\n",
+          core_names[state_core], ok ? "OK" : "FAIL", m->registers[0], m->shift_count);
+  destroy_state(state);
+  return ok;
+}
+
+static bool is_rom(const char *name) {
+  size_t length = strlen(name);
+  return length > 4 && strcmp(name + length - 4, ".nes") == 0;
+}
+
+int main(int argc, char **argv) {
+  int opt;
+  bool check_rmw = false;
+  while ((opt = getopt(argc, argv, "fyirc:s:n:")) != -1) {
+    switch (opt) {
+    case 'f':
+      core = FAST_CORE;
+      break;
+    case 'y':
+      core = SYNC_CORE;
+      break;
+    case 'i':
+      skip_idle_loops = true;
+      break;
+    case 'r':
+      check_rmw = true;
+      break;
+    case 'c':
+      cycles_to_run = (uint32_t) strtol(optarg, NULL, 10);
+      break;
+    case 's':
+      new_pc = (uint16_t) strtol(optarg, NULL, 16);
+      overwrite_pc = true;
+      break;
+    case 'n':
+      history_length = (uint32_t) strtol(optarg, NULL, 10);
+      if (history_length > MAX_HISTORY) { history_length = MAX_HISTORY; }
+      break;
+    default:
+      fprintf(stderr, "Usage: %s [-f|-y] [-i] [-c cycles] [-s pc] [-n instructions] rom|dir...\n       %s -r\n", argv[0], argv[0]);
+      return EXIT_FAILURE;
+    }
+  }
+  if (check_rmw) {
+    uint32_t failed = 0;
+    for (uint8_t c = CYCLE_CORE; c <= SYNC_CORE; c++) {
+      failed += !verify_mmc1_rmw(c);
+    }
+    return failed > 0 ? EXIT_FAILURE : 0;
+  }
+  if (optind >= argc) {
+    fprintf(stderr, "Usage: %s [-f|-y] [-i] [-c cycles] [-s pc] [-n instructions] rom|dir...\n       %s -r\n", argv[0], argv[0]);
+    return EXIT_FAILURE;
+  }
+  fprintf(stderr, "Verifying the %s core%s against the cycle core\n",
+          core_names[core], skip_idle_loops ? " (idle loops skipped)" : "");
+
+  uint32_t failed = 0;
+  for (int i = optind; i < argc; i++) {
+    DIR *dir = opendir(argv[i]);
+    if (dir == NULL) {
+      failed += !verify(argv[i]);
+      continue;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+      if (!is_rom(entry->d_name)) { continue; }
+      char path[4096];
+      snprintf(path, sizeof(path), "%s/%s", argv[i], entry->d_name);
+      failed += !verify(path);
+    }
+    closedir(dir);
+  }
+  return failed > 0 ? EXIT_FAILURE : 0;
+}
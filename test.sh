@@ -1,6 +1,6 @@
 CYCLES=26700
 
-./emu -s 0xc000 -c $CYCLES test/nestest.nes
+./emu -s 0xc000 -c $CYCLES "$@" test/nestest.nes
 UNAME=$(uname)
 if [ $UNAME = "Linux" ]
 then